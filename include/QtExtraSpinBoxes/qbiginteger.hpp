@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2025 Trần Nam Tuấn <tuantran1632001@gmail.com>
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef QTEXTRASPINBOXES_QBIGINTEGER_HPP
+#define QTEXTRASPINBOXES_QBIGINTEGER_HPP
+
+#include <QtExtraSpinBoxes/qtextraspinboxes_export.hpp>
+
+#include <QDebug>
+#include <QString>
+#include <QVarLengthArray>
+
+#include <limits>
+#include <type_traits>
+
+namespace QtExtraSpinBoxes
+{
+// Signed integer of arbitrary size. Values up to 128 bits keep their limbs
+// inline, larger ones spill them to the heap.
+class QTEXTRASPINBOXES_EXPORT QBigInteger
+{
+public:
+    QBigInteger() noexcept = default;
+
+    template<typename I, std::enable_if_t<std::is_integral_v<I> && !std::is_same_v<I, bool>, bool> = true>
+    QBigInteger(I value) noexcept
+    {
+        using U = std::make_unsigned_t<I>;
+        negative = value < 0;
+        U magnitude = negative ? U(0) - static_cast<U>(value) : static_cast<U>(value);
+        while (magnitude != 0) {
+            limbs.append(static_cast<Limb>(magnitude));
+            if constexpr (std::numeric_limits<U>::digits > std::numeric_limits<Limb>::digits) {
+                magnitude >>= std::numeric_limits<Limb>::digits;
+            } else {
+                magnitude = 0;
+            }
+        }
+    }
+
+    // Truncates towards zero, non-finite values become 0.
+    explicit QBigInteger(double value);
+
+    static QBigInteger fromString(QStringView text, int base = 10, bool *ok = nullptr);
+    QString toString(int base = 10) const;
+
+    double toDouble() const noexcept;
+    explicit operator double() const noexcept
+    {
+        return toDouble();
+    }
+
+    bool isZero() const noexcept
+    {
+        return limbs.isEmpty();
+    }
+
+    bool isNegative() const noexcept
+    {
+        return negative;
+    }
+
+    QBigInteger operator-() const;
+
+    QBigInteger &operator+=(const QBigInteger &other);
+    QBigInteger &operator-=(const QBigInteger &other);
+    QBigInteger &operator*=(const QBigInteger &other);
+    // Division truncates towards zero, the remainder takes the sign of the dividend.
+    QBigInteger &operator/=(const QBigInteger &other);
+    QBigInteger &operator%=(const QBigInteger &other);
+
+    friend QBigInteger operator+(QBigInteger a, const QBigInteger &b)
+    {
+        return a += b;
+    }
+
+    friend QBigInteger operator-(QBigInteger a, const QBigInteger &b)
+    {
+        return a -= b;
+    }
+
+    friend QBigInteger operator*(QBigInteger a, const QBigInteger &b)
+    {
+        return a *= b;
+    }
+
+    friend QBigInteger operator/(QBigInteger a, const QBigInteger &b)
+    {
+        return a /= b;
+    }
+
+    friend QBigInteger operator%(QBigInteger a, const QBigInteger &b)
+    {
+        return a %= b;
+    }
+
+    friend bool operator==(const QBigInteger &a, const QBigInteger &b) noexcept
+    {
+        return a.negative == b.negative && a.limbs == b.limbs;
+    }
+
+    friend bool operator!=(const QBigInteger &a, const QBigInteger &b) noexcept
+    {
+        return !(a == b);
+    }
+
+    friend bool operator<(const QBigInteger &a, const QBigInteger &b) noexcept
+    {
+        return compare(a, b) < 0;
+    }
+
+    friend bool operator<=(const QBigInteger &a, const QBigInteger &b) noexcept
+    {
+        return compare(a, b) <= 0;
+    }
+
+    friend bool operator>(const QBigInteger &a, const QBigInteger &b) noexcept
+    {
+        return compare(a, b) > 0;
+    }
+
+    friend bool operator>=(const QBigInteger &a, const QBigInteger &b) noexcept
+    {
+        return compare(a, b) >= 0;
+    }
+
+private:
+    using Limb = quint32;
+
+    static int compare(const QBigInteger &a, const QBigInteger &b) noexcept;
+
+    // Magnitude, least significant limb first, without leading zero limbs.
+    QVarLengthArray<Limb, 4> limbs;
+    bool negative = false;
+};
+
+QTEXTRASPINBOXES_EXPORT QDebug operator<<(QDebug debug, const QBigInteger &value);
+} // namespace QtExtraSpinBoxes
+
+#endif // QTEXTRASPINBOXES_QBIGINTEGER_HPP
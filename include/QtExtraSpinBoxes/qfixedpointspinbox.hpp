@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2025 Trần Nam Tuấn <tuantran1632001@gmail.com>
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef QTEXTRASPINBOXES_QFIXEDPOINTSPINBOX_HPP
+#define QTEXTRASPINBOXES_QFIXEDPOINTSPINBOX_HPP
+
+#include <QtExtraSpinBoxes/qfixedpoint64spinbox.hpp>
+#include <QtExtraSpinBoxes/qufixedpoint64spinbox.hpp>
+
+#include <limits>
+#include <type_traits>
+
+namespace QtExtraSpinBoxes
+{
+// Decimal spin box with Scale fraction digits fixed at compile time. Values
+// are integer counts of 10^-Scale units, so with Scale 2 the value 1234 shows
+// as 12.34. Text is formatted and parsed with integer arithmetic only, in
+// the locale's digits and decimal point. Properties and signals are those of
+// the base class.
+template<typename Rep, int Scale>
+class QFixedPointSpinBox : public std::conditional_t<std::is_signed_v<Rep>, QFixedPoint64SpinBox, QUFixedPoint64SpinBox>
+{
+    static_assert(std::is_same_v<Rep, qint64> || std::is_same_v<Rep, quint64>, "QFixedPointSpinBox: Rep must be qint64 or quint64");
+    static_assert(Scale >= 0 && Scale <= std::numeric_limits<Rep>::digits10, "QFixedPointSpinBox: 10^Scale must fit Rep");
+
+public:
+    using Base = std::conditional_t<std::is_signed_v<Rep>, QFixedPoint64SpinBox, QUFixedPoint64SpinBox>;
+
+    // 10^Scale, the value of 1.
+    static constexpr Rep unit = [] {
+        Rep r = 1;
+        for (int i = 0; i < Scale; ++i) {
+            r *= 10;
+        }
+        return r;
+    }();
+
+    explicit QFixedPointSpinBox(QWidget *parent = nullptr)
+        : Base{Scale, parent}
+    {
+    }
+};
+} // namespace QtExtraSpinBoxes
+
+#endif // QTEXTRASPINBOXES_QFIXEDPOINTSPINBOX_HPP
@@ -8,8 +8,10 @@
 #include <QSpinBox>
 #else
 #include <QtExtraSpinBoxes/qtextraspinboxes_export.hpp>
+#include <QtExtraSpinBoxes/qtextraspinboxes_global.hpp>
 
 #include <QAbstractSpinBox>
+#include <QList>
 #endif
 
 namespace QtExtraSpinBoxes
@@ -28,8 +30,24 @@ class QTEXTRASPINBOXES_EXPORT QInt32SpinBox : public QAbstractSpinBox
     Q_PROPERTY(QtExtraSpinBoxes::QInt32SpinBox::Type maximum READ maximum WRITE setMaximum)
     Q_PROPERTY(QtExtraSpinBoxes::QInt32SpinBox::Type singleStep READ singleStep WRITE setSingleStep)
     Q_PROPERTY(StepType stepType READ stepType WRITE setStepType)
+    Q_PROPERTY(int adaptiveSignificantDigits READ adaptiveSignificantDigits WRITE setAdaptiveSignificantDigits)
+    Q_PROPERTY(QtExtraSpinBoxes::StepMode stepMode READ stepMode WRITE setStepMode)
+    Q_PROPERTY(QtExtraSpinBoxes::QInt32SpinBox::Type stepFactor READ stepFactor WRITE setStepFactor)
+    Q_PROPERTY(QtExtraSpinBoxes::OverflowPolicy overflowPolicy READ overflowPolicy WRITE setOverflowPolicy)
+    Q_PROPERTY(bool cursorDigitStepping READ isCursorDigitStepping WRITE setCursorDigitStepping)
     Q_PROPERTY(QtExtraSpinBoxes::QInt32SpinBox::Type value READ value WRITE setValue NOTIFY valueChanged USER true)
     Q_PROPERTY(int displayIntegerBase READ displayIntegerBase WRITE setDisplayIntegerBase)
+    Q_PROPERTY(bool chromeCached READ isChromeCached WRITE setChromeCached)
+    Q_PROPERTY(bool glyphCached READ isGlyphCached WRITE setGlyphCached)
+    Q_PROPERTY(bool framePaced READ isFramePaced WRITE setFramePaced)
+    Q_PROPERTY(QtExtraSpinBoxes::AccelerationCurve accelerationCurve READ accelerationCurve WRITE setAccelerationCurve)
+    Q_PROPERTY(QtExtraSpinBoxes::WheelMode wheelMode READ wheelMode WRITE setWheelMode)
+    Q_PROPERTY(bool scrubEnabled READ isScrubEnabled WRITE setScrubEnabled)
+    Q_PROPERTY(QtExtraSpinBoxes::AccelerationCurve scrubCurve READ scrubCurve WRITE setScrubCurve)
+    Q_PROPERTY(int keyboardTrackingDelay READ keyboardTrackingDelay WRITE setKeyboardTrackingDelay)
+    Q_PROPERTY(int emissionInterval READ emissionInterval WRITE setEmissionInterval)
+    Q_PROPERTY(bool interacting READ isInteracting)
+    Q_PROPERTY(QtExtraSpinBoxes::QInt32SpinBox::Type deadband READ deadband WRITE setDeadband)
     Q_DISABLE_COPY(QInt32SpinBox)
 public:
     using Type = qint32;
@@ -47,6 +65,12 @@ public:
 
     void setRange(Type minimum, Type maximum);
 
+    // Restricts the value to these values within the range, stepping moves
+    // through them in order. An empty list, or one without a value in the
+    // range, allows any value.
+    QList<Type> allowedValues() const;
+    void setAllowedValues(const QList<Type> &values);
+
     Type singleStep() const;
     void setSingleStep(Type value);
 
@@ -62,10 +86,62 @@ public:
     QAbstractSpinBox::StepType stepType() const;
     void setStepType(StepType stepType);
 
+    int adaptiveSignificantDigits() const;
+    void setAdaptiveSignificantDigits(int digits);
+
+    QtExtraSpinBoxes::StepMode stepMode() const;
+    void setStepMode(QtExtraSpinBoxes::StepMode mode);
+
+    Type stepFactor() const;
+    void setStepFactor(Type factor);
+
+    QtExtraSpinBoxes::OverflowPolicy overflowPolicy() const;
+    void setOverflowPolicy(QtExtraSpinBoxes::OverflowPolicy policy);
+
+    bool isCursorDigitStepping() const;
+    void setCursorDigitStepping(bool enable);
+
+    bool isChromeCached() const;
+    void setChromeCached(bool enable);
+
+    bool isGlyphCached() const;
+    void setGlyphCached(bool enable);
+
+    bool isFramePaced() const;
+    void setFramePaced(bool enable);
+
+    QtExtraSpinBoxes::AccelerationCurve accelerationCurve() const;
+    void setAccelerationCurve(QtExtraSpinBoxes::AccelerationCurve curve);
+    void setAccelerationFunction(const QtExtraSpinBoxes::AccelerationFunction &function);
+
+    QtExtraSpinBoxes::WheelMode wheelMode() const;
+    void setWheelMode(QtExtraSpinBoxes::WheelMode mode);
+
+    bool isScrubEnabled() const;
+    void setScrubEnabled(bool enable);
+
+    QtExtraSpinBoxes::AccelerationCurve scrubCurve() const;
+    void setScrubCurve(QtExtraSpinBoxes::AccelerationCurve curve);
+    void setScrubFunction(const QtExtraSpinBoxes::ScrubFunction &function);
+
+    int keyboardTrackingDelay() const;
+    void setKeyboardTrackingDelay(int msec);
+
+    int emissionInterval() const;
+    void setEmissionInterval(int msec);
+    bool isInteracting() const;
+
+    Type deadband() const;
+    void setDeadband(Type delta);
+
     Type value() const;
+    QString valueText() const;
 
     void fixup(QString &input) const override;
     void stepBy(int steps) override;
+    void stepUpBy(Type count);
+    void stepDownBy(Type count);
+    void stepTo(Type target);
     QValidator::State validate(QString &input, int &pos) const override;
 
     bool event(QEvent *event) override;
@@ -79,6 +155,12 @@ public Q_SLOTS:
 Q_SIGNALS:
     void textChanged(const QString &text);
     void valueChanged(QtExtraSpinBoxes::QInt32SpinBox::Type value);
+    // A button, key, scrub or wheel burst always ends with inProgress false. When its last value
+    // was already emitted in progress, only this signal is emitted again, with oldValue equal to newValue.
+    void valueChangedDetailed(QtExtraSpinBoxes::QInt32SpinBox::Type oldValue,
+                              QtExtraSpinBoxes::QInt32SpinBox::Type newValue,
+                              QtExtraSpinBoxes::ValueChangeSource source,
+                              bool inProgress);
 
 protected:
     virtual QString textFromValue(Type value) const;
@@ -101,6 +183,7 @@ protected:
     void mouseMoveEvent(QMouseEvent *event) override;
     void mousePressEvent(QMouseEvent *event) override;
     void mouseReleaseEvent(QMouseEvent *event) override;
+    void paintEvent(QPaintEvent *event) override;
     void resizeEvent(QResizeEvent *event) override;
     void showEvent(QShowEvent *event) override;
     void timerEvent(QTimerEvent *event) override;
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2025 Trần Nam Tuấn <tuantran1632001@gmail.com>
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef QTEXTRASPINBOXES_GLOBAL_HPP
+#define QTEXTRASPINBOXES_GLOBAL_HPP
+
+#include <QtExtraSpinBoxes/qtextraspinboxes_export.hpp>
+
+#include <QObject>
+
+#include <chrono>
+#include <functional>
+
+namespace QtExtraSpinBoxes
+{
+Q_NAMESPACE_EXPORT(QTEXTRASPINBOXES_EXPORT)
+
+// How the auto-repeat rate of a held spin button grows while accelerated.
+enum AccelerationCurve {
+    LinearAcceleration,
+    ExponentialAcceleration,
+    EaseInAcceleration,
+    CustomAcceleration
+};
+Q_ENUM_NS(AccelerationCurve)
+
+// How wheel and touchpad scrolling is turned into steps.
+enum WheelMode {
+    // One step per 120 units of angle delta, applied on every event.
+    AngleDeltaWheel,
+    // Uses pixel deltas when available, merges the events of one event loop
+    // iteration into a single step and scales it by the scroll velocity.
+    PrecisionWheel
+};
+Q_ENUM_NS(WheelMode)
+
+// How a step changes the value.
+enum StepMode {
+    // Adds singleStep, or the adaptive decimal step, per step.
+    AdditiveStep,
+    // Multiplies or divides by stepFactor per step, crossing zero through singleStep.
+    MultiplicativeStep,
+    // Moves through the values with one significant digit, so 8, 9, 10, 20, ... 90, 100.
+    DecadeStep
+};
+Q_ENUM_NS(StepMode)
+
+// What a step does when the result does not fit the value type. The range is
+// applied afterwards, and types without limits never overflow.
+enum OverflowPolicy {
+    // Clamps to the limit of the type.
+    SaturateOnOverflow,
+    // Wraps modulo 2^N, like unsigned arithmetic. Only when the range is the
+    // whole type, a narrower range saturates instead of landing on its other
+    // end. Use QAbstractSpinBox::wrapping to wrap within the range.
+    WrapOnOverflow,
+    // Leaves the value as it is.
+    RejectOnOverflow
+};
+Q_ENUM_NS(OverflowPolicy)
+
+// What caused a value change. The input values match the internal button flags.
+enum ValueChangeSource {
+    ProgrammaticChange = 0x0,
+    KeyboardChange = 0x1,
+    MouseChange = 0x2,
+    WheelChange = 0x4
+};
+Q_ENUM_NS(ValueChangeSource)
+
+// Maps the time a spin button has been held to a repeat rate in steps per second.
+using AccelerationFunction = std::function<qreal(std::chrono::milliseconds held)>;
+
+// Maps the vertical distance dragged from a pressed spin button, in pixels,
+// to a scrub rate in steps per second.
+using ScrubFunction = std::function<qreal(int distance)>;
+} // namespace QtExtraSpinBoxes
+
+#endif // QTEXTRASPINBOXES_GLOBAL_HPP
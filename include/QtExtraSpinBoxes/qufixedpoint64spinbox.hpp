@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: 2025 Trần Nam Tuấn <tuantran1632001@gmail.com>
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef QTEXTRASPINBOXES_QUFIXEDPOINT64SPINBOX_HPP
+#define QTEXTRASPINBOXES_QUFIXEDPOINT64SPINBOX_HPP
+
+#include <QtExtraSpinBoxes/qtextraspinboxes_export.hpp>
+#include <QtExtraSpinBoxes/qtextraspinboxes_global.hpp>
+
+#include <QAbstractSpinBox>
+#include <QList>
+
+namespace QtExtraSpinBoxes
+{
+class QUFixedPoint64SpinBoxPrivate;
+class QTEXTRASPINBOXES_EXPORT QUFixedPoint64SpinBox : public QAbstractSpinBox
+{
+    Q_OBJECT
+    Q_PROPERTY(QString suffix READ suffix WRITE setSuffix)
+    Q_PROPERTY(QString prefix READ prefix WRITE setPrefix)
+    Q_PROPERTY(QString cleanText READ cleanText)
+    Q_PROPERTY(QtExtraSpinBoxes::QUFixedPoint64SpinBox::Type minimum READ minimum WRITE setMinimum)
+    Q_PROPERTY(QtExtraSpinBoxes::QUFixedPoint64SpinBox::Type maximum READ maximum WRITE setMaximum)
+    Q_PROPERTY(QtExtraSpinBoxes::QUFixedPoint64SpinBox::Type singleStep READ singleStep WRITE setSingleStep)
+    Q_PROPERTY(StepType stepType READ stepType WRITE setStepType)
+    Q_PROPERTY(int adaptiveSignificantDigits READ adaptiveSignificantDigits WRITE setAdaptiveSignificantDigits)
+    Q_PROPERTY(QtExtraSpinBoxes::StepMode stepMode READ stepMode WRITE setStepMode)
+    Q_PROPERTY(QtExtraSpinBoxes::QUFixedPoint64SpinBox::Type stepFactor READ stepFactor WRITE setStepFactor)
+    Q_PROPERTY(QtExtraSpinBoxes::OverflowPolicy overflowPolicy READ overflowPolicy WRITE setOverflowPolicy)
+    Q_PROPERTY(bool cursorDigitStepping READ isCursorDigitStepping WRITE setCursorDigitStepping)
+    Q_PROPERTY(QtExtraSpinBoxes::QUFixedPoint64SpinBox::Type value READ value WRITE setValue NOTIFY valueChanged USER true)
+    Q_PROPERTY(int displayIntegerBase READ displayIntegerBase WRITE setDisplayIntegerBase)
+    Q_PROPERTY(int decimals READ decimals)
+    Q_PROPERTY(bool chromeCached READ isChromeCached WRITE setChromeCached)
+    Q_PROPERTY(bool glyphCached READ isGlyphCached WRITE setGlyphCached)
+    Q_PROPERTY(bool framePaced READ isFramePaced WRITE setFramePaced)
+    Q_PROPERTY(QtExtraSpinBoxes::AccelerationCurve accelerationCurve READ accelerationCurve WRITE setAccelerationCurve)
+    Q_PROPERTY(QtExtraSpinBoxes::WheelMode wheelMode READ wheelMode WRITE setWheelMode)
+    Q_PROPERTY(bool scrubEnabled READ isScrubEnabled WRITE setScrubEnabled)
+    Q_PROPERTY(QtExtraSpinBoxes::AccelerationCurve scrubCurve READ scrubCurve WRITE setScrubCurve)
+    Q_PROPERTY(int keyboardTrackingDelay READ keyboardTrackingDelay WRITE setKeyboardTrackingDelay)
+    Q_PROPERTY(int emissionInterval READ emissionInterval WRITE setEmissionInterval)
+    Q_PROPERTY(bool interacting READ isInteracting)
+    Q_PROPERTY(QtExtraSpinBoxes::QUFixedPoint64SpinBox::Type deadband READ deadband WRITE setDeadband)
+    Q_DISABLE_COPY(QUFixedPoint64SpinBox)
+public:
+    using Type = quint64;
+
+    // The value counts units of 10^-decimals, so 12.34 with 2 decimals is 1234.
+    explicit QUFixedPoint64SpinBox(int decimals, QWidget *parent = nullptr);
+    ~QUFixedPoint64SpinBox() override;
+
+    QString cleanText() const;
+
+    Type minimum() const;
+    void setMinimum(Type minimum);
+
+    Type maximum() const;
+    void setMaximum(Type maximum);
+
+    void setRange(Type minimum, Type maximum);
+
+    // Restricts the value to these values within the range, stepping moves
+    // through them in order. An empty list, or one without a value in the
+    // range, allows any value.
+    QList<Type> allowedValues() const;
+    void setAllowedValues(const QList<Type> &values);
+
+    Type singleStep() const;
+    void setSingleStep(Type value);
+
+    int displayIntegerBase() const;
+    void setDisplayIntegerBase(int base);
+
+    int decimals() const;
+
+    QString prefix() const;
+    void setPrefix(const QString &prefix);
+
+    QString suffix() const;
+    void setSuffix(const QString &suffix);
+
+    QAbstractSpinBox::StepType stepType() const;
+    void setStepType(StepType stepType);
+
+    int adaptiveSignificantDigits() const;
+    void setAdaptiveSignificantDigits(int digits);
+
+    QtExtraSpinBoxes::StepMode stepMode() const;
+    void setStepMode(QtExtraSpinBoxes::StepMode mode);
+
+    Type stepFactor() const;
+    void setStepFactor(Type factor);
+
+    QtExtraSpinBoxes::OverflowPolicy overflowPolicy() const;
+    void setOverflowPolicy(QtExtraSpinBoxes::OverflowPolicy policy);
+
+    bool isCursorDigitStepping() const;
+    void setCursorDigitStepping(bool enable);
+
+    bool isChromeCached() const;
+    void setChromeCached(bool enable);
+
+    bool isGlyphCached() const;
+    void setGlyphCached(bool enable);
+
+    bool isFramePaced() const;
+    void setFramePaced(bool enable);
+
+    QtExtraSpinBoxes::AccelerationCurve accelerationCurve() const;
+    void setAccelerationCurve(QtExtraSpinBoxes::AccelerationCurve curve);
+    void setAccelerationFunction(const QtExtraSpinBoxes::AccelerationFunction &function);
+
+    QtExtraSpinBoxes::WheelMode wheelMode() const;
+    void setWheelMode(QtExtraSpinBoxes::WheelMode mode);
+
+    bool isScrubEnabled() const;
+    void setScrubEnabled(bool enable);
+
+    QtExtraSpinBoxes::AccelerationCurve scrubCurve() const;
+    void setScrubCurve(QtExtraSpinBoxes::AccelerationCurve curve);
+    void setScrubFunction(const QtExtraSpinBoxes::ScrubFunction &function);
+
+    int keyboardTrackingDelay() const;
+    void setKeyboardTrackingDelay(int msec);
+
+    int emissionInterval() const;
+    void setEmissionInterval(int msec);
+    bool isInteracting() const;
+
+    Type deadband() const;
+    void setDeadband(Type delta);
+
+    Type value() const;
+    QString valueText() const;
+
+    void fixup(QString &input) const override;
+    void stepBy(int steps) override;
+    void stepUpBy(Type count);
+    void stepDownBy(Type count);
+    void stepTo(Type target);
+    QValidator::State validate(QString &input, int &pos) const override;
+
+    bool event(QEvent *event) override;
+    QSize minimumSizeHint() const override;
+    QSize sizeHint() const override;
+
+public Q_SLOTS:
+    void clear() override;
+    void setValue(QtExtraSpinBoxes::QUFixedPoint64SpinBox::Type value);
+
+Q_SIGNALS:
+    void textChanged(const QString &text);
+    void valueChanged(QtExtraSpinBoxes::QUFixedPoint64SpinBox::Type value);
+    // A button, key, scrub or wheel burst always ends with inProgress false. When its last value
+    // was already emitted in progress, only this signal is emitted again, with oldValue equal to newValue.
+    void valueChangedDetailed(QtExtraSpinBoxes::QUFixedPoint64SpinBox::Type oldValue,
+                              QtExtraSpinBoxes::QUFixedPoint64SpinBox::Type newValue,
+                              QtExtraSpinBoxes::ValueChangeSource source,
+                              bool inProgress);
+
+protected:
+    virtual QString textFromValue(Type value) const;
+    virtual Type valueFromText(const QString &text) const;
+
+    void initStyleOption(QStyleOptionSpinBox *option) const override;
+    QAbstractSpinBox::StepEnabled stepEnabled() const override;
+
+    void changeEvent(QEvent *event) override;
+    void closeEvent(QCloseEvent *event) override;
+
+#if QT_CONFIG(contextmenu)
+    void contextMenuEvent(QContextMenuEvent *event) override;
+#endif // QT_CONFIG(contextmenu)
+
+    void focusOutEvent(QFocusEvent *event) override;
+    void hideEvent(QHideEvent *event) override;
+    void keyPressEvent(QKeyEvent *event) override;
+    void keyReleaseEvent(QKeyEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+    void timerEvent(QTimerEvent *event) override;
+
+#if QT_CONFIG(wheelevent)
+    void wheelEvent(QWheelEvent *event) override;
+#endif // QT_CONFIG(wheelevent)
+
+private:
+    Q_DECLARE_PRIVATE(QUFixedPoint64SpinBox)
+    QScopedPointer<QUFixedPoint64SpinBoxPrivate> d_ptr;
+};
+} // namespace QtExtraSpinBoxes
+
+#endif // QTEXTRASPINBOXES_QUFIXEDPOINT64SPINBOX_HPP
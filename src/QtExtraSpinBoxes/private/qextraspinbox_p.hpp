@@ -4,20 +4,46 @@
 #ifndef QTEXTRASPINBOXES_P_H
 #define QTEXTRASPINBOXES_P_H
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <limits>
 #include <optional>
+#include <utility>
+
+#include "QtExtraSpinBoxes/private/qextraspinboxarithmetic_p.hpp"
+
+#include <QtExtraSpinBoxes/qbiginteger.hpp>
+#include <QtExtraSpinBoxes/qtextraspinboxes_global.hpp>
 
 #include <QAbstractSpinBox>
 #include <QAccessibleValueChangeEvent>
 #include <QBasicTimer>
+#include <QCache>
 #include <QContextMenuEvent>
+#include <QElapsedTimer>
 #include <QEvent>
+#include <QGlyphRun>
 #include <QGuiApplication>
+#include <QHash>
 #include <QLineEdit>
+#include <QLocale>
 #include <QMenu>
+#include <QMetaMethod>
+#include <QPainter>
+#include <QPixmapCache>
 #include <QPointer>
+#include <QRawFont>
+#include <QScopeGuard>
+#include <QScreen>
+#include <QStringList>
 #include <QStyleHints>
 #include <QStyleOptionSpinBox>
+#include <QTextLayout>
 #include <QTimerEvent>
+#include <QVariant>
 
 #ifdef QTEXTRASPINBOXES_QSBDEBUG
 #define QSBDEBUG qDebug
@@ -49,6 +75,9 @@ enum Button {
     DirectionMask = 0x040
 };
 
+static_assert(int(KeyboardChange) == Keyboard && int(MouseChange) == Mouse && int(WheelChange) == Wheel,
+              "ValueChangeSource must match the input flags of Button");
+
 namespace
 {
 template<class T>
@@ -56,98 +85,502 @@ struct dependent_false : std::false_type {
 };
 }
 
-template<typename T, std::enable_if_t<std::is_integral_v<T> && std::is_unsigned_v<T>, bool> = true>
-constexpr static T valueAdd(T a, T b) noexcept
+// QBigInteger has no limits to saturate at.
+inline QBigInteger valueAdd(const QBigInteger &a, const QBigInteger &b)
+{
+    return a + b;
+}
+
+inline QBigInteger valueSub(const QBigInteger &a, const QBigInteger &b)
+{
+    return a - b;
+}
+
+inline QBigInteger valueMul(const QBigInteger &a, const QBigInteger &b)
+{
+    return a * b;
+}
+
+// Unsigned counterpart of T for magnitudes and offsets, T itself where T has no limits.
+template<typename T, typename = void>
+struct Magnitude {
+    using type = T;
+};
+
+template<typename T>
+struct Magnitude<T, std::enable_if_t<std::is_integral_v<T>>> {
+    using type = std::make_unsigned_t<T>;
+};
+
+template<typename T>
+using magnitude_t = typename Magnitude<T>::type;
+
+// Draws the frame and spin buttons through a pixmap shared by every spin box
+// with the same style, size, state, palette and device pixel ratio.
+// Style sheets may render each widget differently for equal options, so
+// widgets under one are drawn directly.
+class QExtraSpinBoxChromeRenderer
+{
+public:
+    static void draw(QPainter *painter, const QWidget *widget, const QStyleOptionSpinBox &option);
+
+private:
+    struct Key {
+        quint64 style = 0;
+        QSize size;
+        int state = 0;
+        int subControls = 0;
+        int activeSubControls = 0;
+        int stepEnabled = 0;
+        int buttonSymbols = 0;
+        int frame = 0;
+        int direction = 0;
+        qint64 palette = 0;
+        qreal dpr = 0;
+
+        friend bool operator==(const Key &a, const Key &b) noexcept
+        {
+            return a.style == b.style && a.size == b.size && a.state == b.state && a.subControls == b.subControls
+                && a.activeSubControls == b.activeSubControls && a.stepEnabled == b.stepEnabled && a.buttonSymbols == b.buttonSymbols
+                && a.frame == b.frame && a.direction == b.direction && a.palette == b.palette && a.dpr == b.dpr;
+        }
+
+        friend size_t qHash(const Key &key, size_t seed = 0) noexcept
+        {
+            return qHashMulti(seed,
+                              key.style,
+                              key.size.width(),
+                              key.size.height(),
+                              key.state,
+                              key.subControls,
+                              key.activeSubControls,
+                              key.stepEnabled,
+                              key.buttonSymbols,
+                              key.frame,
+                              key.direction,
+                              key.palette,
+                              key.dpr);
+        }
+    };
+
+    static Key cacheKey(const QWidget *widget, const QStyleOptionSpinBox &option, qreal dpr);
+    static quint64 styleSerial(const QStyle *style);
+    static void clearKeys();
+
+    // Pixmap cache keys by their option fields, so a hit builds no string.
+    static QHash<Key, QPixmapCache::Key> keys;
+};
+
+// Pre-shaped glyphs for the small alphabet of numeric text, shared per font.
+// A number is assembled from cached glyph indexes and kerned pair advances,
+// so drawing a new value does not go through the shaper. Only affixes, and
+// texts with characters the font lacks, are shaped as whole runs, which are
+// kept in a small LRU cache. Only the most recently used fonts are kept.
+class QExtraSpinBoxGlyphCache
+{
+public:
+    // The returned cache stays valid until the next call.
+    static QExtraSpinBoxGlyphCache *forFont(const QFont &font);
+
+    void draw(QPainter *painter, const QRect &rect, Qt::Alignment alignment, QStringView prefix, QStringView number, QStringView suffix);
+
+private:
+    struct Glyph {
+        // 0 when the font has no glyph for the character.
+        quint32 index = 0;
+        qreal advance = 0;
+    };
+
+    struct Run {
+        QList<QGlyphRun> glyphs;
+        qreal advance = 0;
+    };
+
+    explicit QExtraSpinBoxGlyphCache(const QFont &font);
+
+    static void clearCaches();
+
+    Glyph glyph(char32_t c);
+    qreal pairAdvance(const Glyph &left, const Glyph &right);
+    bool layoutNumber(QStringView number, qreal *width);
+    Run run(const QString &text);
+
+    QFont font;
+    QFontMetricsF metrics;
+    QRawFont rawFont;
+    QHash<char32_t, Glyph> glyphs;
+    QHash<quint64, qreal> pairs;
+    QCache<QString, Run> runs{64};
+    // Reused between draws to avoid allocating.
+    QList<quint32> numberIndexes;
+    QList<QPointF> numberPositions;
+
+    static QCache<QString, QExtraSpinBoxGlyphCache> caches;
+};
+
+// Drives the auto-repeat of whichever spin box is currently held, from a
+// single timer shared by the whole application. Steps are derived from the
+// time spent repeating, so a late timer catches up instead of dropping steps.
+class QExtraSpinBoxRepeatDriver : public QObject
+{
+public:
+    // Returns the repeat rate, in steps per second, after the given time spent repeating.
+    using RateFunction = std::function<qreal(std::chrono::milliseconds elapsed)>;
+    // Takes as many of the steps as it can and returns the rest, which are carried to the next tick.
+    using StepFunction = std::function<qint64(qint64 steps)>;
+
+    // With stepOnThreshold, crossing the threshold steps once right away, like a held button.
+    static void start(const void *owner,
+                      std::chrono::milliseconds threshold,
+                      std::chrono::milliseconds minimumInterval,
+                      bool stepOnThreshold,
+                      RateFunction rate,
+                      StepFunction step);
+    static void stop(const void *owner);
+    static bool isActive(const void *owner);
+    static bool isRepeating(const void *owner);
+
+protected:
+    void timerEvent(QTimerEvent *event) override;
+
+private:
+    explicit QExtraSpinBoxRepeatDriver(QObject *parent);
+
+    static QExtraSpinBoxRepeatDriver *instance(bool create);
+
+    const void *owner = nullptr;
+    quint64 generation = 0;
+    QBasicTimer timer;
+    QElapsedTimer clock;
+    std::chrono::nanoseconds threshold{0};
+    std::chrono::nanoseconds lastTick{0};
+    std::chrono::milliseconds minimumInterval{0};
+    qreal pendingSteps = 0;
+    bool stepOnThreshold = false;
+    bool repeating = false;
+    RateFunction rate;
+    StepFunction step;
+};
+
+inline QBigInteger decadeOf(const QBigInteger &magnitude)
 {
-    T r = a + b;
-    if (r < a) {
-        return std::numeric_limits<T>::max();
+    // From the digit count, one conversion instead of a division per decade.
+    const qsizetype digits = magnitude.isZero() ? 1 : magnitude.toString().size();
+    return QBigInteger::fromString(QString(digits - 1, u'0').prepend(u'1'));
+}
+
+// QString::number() and QLocale have no 128-bit overloads, and QString::number()
+// of a negative value in another base than 10 formats its two's complement.
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+static QString integerToString(T value, int base)
+{
+    using U = std::make_unsigned_t<T>;
+    const bool negative = value < 0;
+    U magnitude = negative ? U(0) - static_cast<U>(value) : static_cast<U>(value);
+
+    char16_t buffer[std::numeric_limits<U>::digits + 1];
+    qsizetype pos = std::size(buffer);
+    const auto putDigits = [&](quint64 digits, int count) {
+        do {
+            const int digit = static_cast<int>(digits % base);
+            buffer[--pos] = static_cast<char16_t>(digit < 10 ? u'0' + digit : u'a' + digit - 10);
+            digits /= base;
+        } while (--count > 0 || (count < 0 && digits != 0));
+    };
+
+    if constexpr (std::numeric_limits<U>::digits > std::numeric_limits<quint64>::digits) {
+        if (base == 10) {
+            // Split off 19 digits per wide division, the digits themselves are 64-bit work.
+            constexpr quint64 chunk = 10'000'000'000'000'000'000ULL;
+            while (magnitude >= chunk) {
+                putDigits(static_cast<quint64>(magnitude % chunk), 19);
+                magnitude /= chunk;
+            }
+        } else {
+            while (magnitude > std::numeric_limits<quint64>::max()) {
+                putDigits(static_cast<quint64>(magnitude % static_cast<U>(base)), 1);
+                magnitude /= static_cast<U>(base);
+            }
+        }
+    }
+    putDigits(static_cast<quint64>(magnitude), -1);
+
+    if (negative) {
+        buffer[--pos] = u'-';
     }
-    return r;
+    return QStringView(buffer + pos, std::size(buffer) - pos).toString();
 }
 
-template<typename T, std::enable_if_t<std::is_integral_v<T> && std::is_unsigned_v<T>, bool> = true>
-constexpr static T valueSub(T a, T b) noexcept
+// Parses an optionally signed number in base. Fails on anything else and on overflow.
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+static T stringToInteger(QStringView text, int base, bool *ok)
 {
-    if (a < b) {
+    using U = std::make_unsigned_t<T>;
+    *ok = false;
+
+    const bool negative = text.startsWith(u'-');
+    if (negative || text.startsWith(u'+')) {
+        text = text.sliced(1);
+    }
+    if (text.isEmpty()) {
         return 0;
     }
-    return a - b;
+
+    U limit = static_cast<U>(std::numeric_limits<T>::max());
+    if (negative) {
+        limit = U(0) - static_cast<U>(std::numeric_limits<T>::min());
+    }
+    // One wide division up front instead of one per digit.
+    const U cutoff = limit / static_cast<U>(base);
+    const int cutoffDigit = static_cast<int>(limit % static_cast<U>(base));
+
+    U magnitude = 0;
+    for (const QChar c : text) {
+        const char16_t u = c.unicode();
+        int digit = base;
+        if (u >= u'0' && u <= u'9') {
+            digit = u - u'0';
+        } else if (u >= u'a' && u <= u'z') {
+            digit = u - u'a' + 10;
+        } else if (u >= u'A' && u <= u'Z') {
+            digit = u - u'A' + 10;
+        }
+        if (digit >= base || magnitude > cutoff || (magnitude == cutoff && digit > cutoffDigit)) {
+            return 0;
+        }
+        magnitude = magnitude * static_cast<U>(base) + static_cast<U>(digit);
+    }
+
+    *ok = true;
+    return negative ? static_cast<T>(U(0) - magnitude) : static_cast<T>(magnitude);
 }
 
-template<typename T, std::enable_if_t<std::is_integral_v<T> && std::is_unsigned_v<T>, bool> = true>
-constexpr static T valueMul(T a, T b) noexcept
+inline QString integerToString(const QBigInteger &value, int base)
 {
-    // If b == 0 should error?
-    if (a == 0 || b == 0) {
-        return 0;
+    return value.toString(base);
+}
+
+template<typename T, std::enable_if_t<std::is_same_v<T, QBigInteger>, bool> = true>
+static T stringToInteger(QStringView text, int base, bool *ok)
+{
+    return QBigInteger::fromString(text, base, ok);
+}
+
+// Digit grouping of a locale: the size of the lowest group, of the groups above
+// it, and the fewest digits above the lowest group for grouping to start.
+struct LocaleGrouping {
+    int first = 0;
+    int higher = 0;
+    int least = 1;
+};
+
+// QLocale keeps its grouping sizes private, they are read back from numbers it
+// formats itself. A first size of 0 means the locale does not group. This
+// formats several numbers, so callers keep the result per locale.
+inline LocaleGrouping localeGrouping(QLocale locale)
+{
+    LocaleGrouping grouping;
+    const QString separator = locale.groupSeparator();
+    const qsizetype width = qMax<qsizetype>(1, locale.zeroDigit().size());
+    if (separator.isEmpty()) {
+        return grouping;
     }
-    if (a > std::numeric_limits<T>::max() / b) {
-        return std::numeric_limits<T>::max();
+    locale.setNumberOptions(locale.numberOptions() & ~QLocale::OmitGroupSeparator);
+
+    const QStringList groups = locale.toString(std::numeric_limits<qint64>::max()).split(separator);
+    if (groups.size() < 2) {
+        return grouping;
     }
-    return a * b;
+    grouping.first = static_cast<int>(groups.last().size() / width);
+    grouping.higher = groups.size() > 2 ? static_cast<int>(groups.at(groups.size() - 2).size() / width) : grouping.first;
+    if (grouping.first == 0 || grouping.higher == 0) {
+        return LocaleGrouping();
+    }
+
+    // Some locales leave short numbers ungrouped, 1234 but 12 345.
+    qint64 sample = pow10<quint64>(grouping.first);
+    while (grouping.least < 3 && !locale.toString(sample).contains(separator)) {
+        ++grouping.least;
+        sample *= 10;
+    }
+    return grouping;
 }
 
-template<typename T, std::enable_if_t<std::is_integral_v<T> && std::is_signed_v<T>, bool> = true>
-constexpr static T valueAdd(T a, T b) noexcept
+// The ten digits of a locale, which may lie outside the BMP.
+inline std::array<QString, 10> localeDigits(const QLocale &locale)
 {
-    if (b > 0) {
-        if (a > std::numeric_limits<T>::max() - b) {
-            return std::numeric_limits<T>::max();
+    const QList<uint> zero = locale.zeroDigit().toUcs4();
+    const char32_t zeroPoint = zero.isEmpty() ? U'0' : zero.constFirst();
+    std::array<QString, 10> digits;
+    for (int i = 0; i < 10; ++i) {
+        const char32_t point = zeroPoint + i;
+        digits[i] = QString::fromUcs4(&point, 1);
+    }
+    return digits;
+}
+
+// Formats decimal ASCII digits, as from integerToString(), the way QLocale formats numbers.
+inline QString localizeDigits(const QLocale &locale, const LocaleGrouping &grouping, QString digits, bool grouped = true)
+{
+    const bool negative = digits.startsWith(u'-');
+    if (negative) {
+        digits.remove(0, 1);
+    }
+
+    // Grouped while the digits are still one QChar each.
+    if (grouped && !(locale.numberOptions() & QLocale::OmitGroupSeparator)) {
+        if (grouping.first > 0 && digits.size() >= grouping.first + grouping.least) {
+            const QString separator = locale.groupSeparator();
+            for (qsizetype i = digits.size() - grouping.first; i > 0; i -= grouping.higher) {
+                digits.insert(i, separator);
+            }
         }
-    } else {
-        if (a < std::numeric_limits<T>::min() - b) {
-            return std::numeric_limits<T>::min();
+    }
+
+    if (locale.zeroDigit() != "0"_L1) {
+        const std::array<QString, 10> localDigits = localeDigits(locale);
+        QString text;
+        text.reserve(digits.size() * localDigits[0].size());
+        for (const QChar c : std::as_const(digits)) {
+            if (c >= u'0' && c <= u'9') {
+                text += localDigits[c.unicode() - u'0'];
+            } else {
+                text += c;
+            }
         }
+        digits = text;
     }
-    return a + b;
+    return negative ? locale.negativeSign() + digits : digits;
 }
 
-template<typename T, std::enable_if_t<std::is_integral_v<T> && std::is_signed_v<T>, bool> = true>
-constexpr static T valueSub(T a, T b) noexcept
+// Maps the locale's signs and digits to ASCII. Group separators are left
+// in, so they fail to parse and go through the same fallback as other types.
+inline QString delocalizeDigits(const QLocale &locale, QString text)
 {
-    if (b > 0) {
-        if (a < std::numeric_limits<T>::min() + b) {
-            return std::numeric_limits<T>::min();
+    text.replace(locale.negativeSign(), "-"_L1);
+    text.replace(locale.positiveSign(), "+"_L1);
+    if (locale.zeroDigit() != "0"_L1) {
+        const std::array<QString, 10> localDigits = localeDigits(locale);
+        for (int i = 0; i < 10; ++i) {
+            text.replace(localDigits[i], QString(QChar(u'0' + i)));
         }
+    }
+    return text;
+}
+
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+static QString localeToString(const QLocale &locale, const LocaleGrouping &grouping, T value)
+{
+    if constexpr (std::numeric_limits<T>::digits > std::numeric_limits<quint64>::digits) {
+        return localizeDigits(locale, grouping, integerToString(value, 10));
     } else {
-        if (a > std::numeric_limits<T>::max() + b) {
-            return std::numeric_limits<T>::max();
-        }
+        Q_UNUSED(grouping);
+        return locale.toString(value);
     }
-    return a - b;
 }
 
-template<typename T, std::enable_if_t<std::is_integral_v<T> && std::is_signed_v<T>, bool> = true>
-constexpr static T valueMul(T a, T b) noexcept
+inline QString localeToString(const QLocale &locale, const LocaleGrouping &grouping, const QBigInteger &value)
+{
+    return localizeDigits(locale, grouping, value.toString());
+}
+
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+static T localeToInteger(const QLocale &locale, const QString &text, bool *ok)
+{
+    if constexpr (std::is_same_v<T, int>) {
+        return locale.toInt(text, ok);
+    } else if constexpr (std::is_same_v<T, long>) {
+        return locale.toLong(text, ok);
+    } else if constexpr (std::is_same_v<T, long long>) {
+        return locale.toLongLong(text, ok);
+    } else if constexpr (std::is_same_v<T, short>) {
+        return locale.toShort(text, ok);
+    } else if constexpr (std::is_same_v<T, unsigned int>) {
+        return locale.toUInt(text, ok);
+    } else if constexpr (std::is_same_v<T, unsigned long>) {
+        return locale.toULong(text, ok);
+    } else if constexpr (std::is_same_v<T, unsigned long long>) {
+        return locale.toULongLong(text, ok);
+    } else if constexpr (std::is_same_v<T, unsigned short>) {
+        return locale.toUShort(text, ok);
+    } else if constexpr (std::numeric_limits<T>::digits > std::numeric_limits<quint64>::digits) {
+        return stringToInteger<T>(delocalizeDigits(locale, text), 10, ok);
+    } else {
+        static_assert(dependent_false<T>::value, "QExtraSpinBoxPrivate: Unsupported type!");
+    }
+}
+
+template<typename T, std::enable_if_t<std::is_same_v<T, QBigInteger>, bool> = true>
+static T localeToInteger(const QLocale &locale, const QString &text, bool *ok)
+{
+    return QBigInteger::fromString(delocalizeDigits(locale, text), 10, ok);
+}
+
+// Formats value / 10^decimals exactly, with the fraction padded to decimals digits.
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+static QString localeToFixed(const QLocale &locale, const LocaleGrouping &grouping, T value, int decimals)
+{
+    using U = std::make_unsigned_t<T>;
+    const bool negative = value < 0;
+    const U magnitude = negative ? U(0) - static_cast<U>(value) : static_cast<U>(value);
+    const U scale = pow10<U>(decimals);
+
+    QString text = localizeDigits(locale, grouping, integerToString(magnitude / scale, 10));
+    text += locale.decimalPoint();
+    text += localizeDigits(locale, grouping, integerToString(magnitude % scale, 10).rightJustified(decimals, u'0'), false);
+    return negative ? locale.negativeSign() + text : text;
+}
+
+// Parses a locale formatted number with at most decimals fraction digits as
+// an integer count of 10^-decimals units. The decimal point is optional.
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+static T fixedToInteger(const QLocale &locale, const QString &text, int decimals, bool *ok)
 {
-    // If b == 0 should error?
-    if (a == 0 || b == 0) {
+    using U = std::make_unsigned_t<T>;
+    *ok = false;
+
+    const QString copy = delocalizeDigits(locale, text);
+    const QString point = locale.decimalPoint();
+    const qsizetype pointPos = copy.indexOf(point);
+    QStringView whole = pointPos < 0 ? QStringView(copy) : QStringView(copy).first(pointPos);
+    const QStringView fraction = pointPos < 0 ? QStringView() : QStringView(copy).sliced(pointPos + point.size());
+
+    const bool negative = whole.startsWith(u'-');
+    if (negative || whole.startsWith(u'+')) {
+        whole = whole.sliced(1);
+    }
+    if ((whole.isEmpty() && fraction.isEmpty()) || fraction.size() > decimals) {
+        return 0;
+    }
+    const auto isDigits = [](QStringView digits) {
+        return std::all_of(digits.begin(), digits.end(), [](QChar c) {
+            return c.unicode() >= u'0' && c.unicode() <= u'9';
+        });
+    };
+    if (!isDigits(whole) || !isDigits(fraction)) {
         return 0;
     }
 
-    if (a > 0) {
-        if (b > 0) {
-            if (a > std::numeric_limits<T>::max() / b) {
-                return std::numeric_limits<T>::max();
-            }
-        } else {
-            if (b < std::numeric_limits<T>::min() / a) {
-                return std::numeric_limits<T>::min();
-            }
-        }
-    } else {
-        if (b > 0) {
-            if (a < std::numeric_limits<T>::min() / b) {
-                return std::numeric_limits<T>::min();
-            }
-        } else {
-            if (a < std::numeric_limits<T>::max() / b) {
-                return std::numeric_limits<T>::max();
-            }
-        }
+    bool wholeOk = true;
+    const U wholeValue = whole.isEmpty() ? U(0) : stringToInteger<U>(whole, 10, &wholeOk);
+    bool fractionOk = true;
+    const U fractionValue = fraction.isEmpty() ? U(0) : stringToInteger<U>(fraction, 10, &fractionOk) * pow10<U>(static_cast<int>(decimals - fraction.size()));
+    if (!wholeOk || !fractionOk) {
+        return 0;
     }
-    return a * b;
+
+    U limit = static_cast<U>(std::numeric_limits<T>::max());
+    if (negative) {
+        limit = U(0) - static_cast<U>(std::numeric_limits<T>::min());
+    }
+    const U scale = pow10<U>(decimals);
+    if (fractionValue > limit || wholeValue > (limit - fractionValue) / scale) {
+        return 0;
+    }
+
+    const U magnitude = wholeValue * scale + fractionValue;
+    *ok = true;
+    return negative ? static_cast<T>(U(0) - magnitude) : static_cast<T>(magnitude);
 }
 
 template<typename T>
@@ -180,39 +613,113 @@ public:
     T singleStep = 1;
 
     int displayIntegerBase = 10;
+    // Fixed-point display, the value counts units of 10^-decimals. Base 10 only.
+    int decimals = 0;
 
     QString prefix;
     QString suffix;
 
     QAbstractSpinBox::StepType stepType = QAbstractSpinBox::DefaultStepType;
+    StepMode stepMode = AdditiveStep;
+    // Sorted and unique. When not empty, only these values within the range are accepted.
+    QList<T> allowedValues;
+    // Significant digits the adaptive decimal step works on. 1 steps 345 by
+    // its decade, 100, and 2 by a tenth of that, 10, like QSpinBox.
+    int adaptiveSignificantDigits = 2;
+    OverflowPolicy overflowPolicy = SaturateOnOverflow;
+    T stepFactor = 10;
+
+    AccelerationCurve accelerationCurve = LinearAcceleration;
+    AccelerationFunction accelerationFunction;
+
+    bool scrubEnabled = false;
+    bool scrubbing = false;
+    int scrubDistance = 0;
+    QPoint scrubOrigin;
+    AccelerationCurve scrubCurve = ExponentialAcceleration;
+    ScrubFunction scrubFunction;
 
     bool pendingEmit = false;
     bool cleared = false;
     bool ignoreCursorPositionChanged = false;
     bool ignoreUpdateEdit = false;
+    bool chromeCached = false;
+    bool glyphCached = false;
+    bool framePaced = false;
+    bool editUpdatePending = false;
+    bool selectAllOnEditUpdate = false;
+    bool cursorDigitStepping = false;
+    qsizetype cursorFromEndOnEditUpdate = -1;
 
     mutable QSize cachedMinimumSizeHint;
     mutable QSize cachedSizeHint;
     mutable std::optional<T> cachedValue;
     mutable std::optional<QString> cachedText;
+    mutable std::optional<QString> pendingText;
+    mutable T pendingTextValue{};
     mutable QValidator::State cachedState = QValidator::Invalid;
+    mutable std::optional<LocaleGrouping> cachedGrouping;
+
+    // Sub-control rects in the order QCommonStyle hit-tests them.
+    struct SubControlRects {
+        QRect up;
+        QRect down;
+        QRect frame;
+        QRect editField;
+        QSize size;
+        QAbstractSpinBox::ButtonSymbols buttonSymbols = QAbstractSpinBox::UpDownArrows;
+        bool hasFrame = true;
+        bool valid = false;
+    };
+    mutable SubControlRects cachedSubControlRects;
 
     Qt::KeyboardModifiers keyboardModifiers = Qt::NoModifier;
     Qt::KeyboardModifier stepModifier = Qt::ControlModifier;
+    bool selectOnStep = false;
+    bool animateButton = false;
+    bool buttonsInsideFrame = false;
+    bool disableOnBounds = false;
     QStyle::SubControl hoverControl = QStyle::SC_None;
 
     Button buttonState = None;
+    QAbstractSpinBox::StepEnabled shownStepEnabled = QAbstractSpinBox::StepNone;
 
     QRect hoverRect;
 
-    QBasicTimer spinClickTimer;
+    QBasicTimer displayUpdateTimer;
+    QBasicTimer keyboardTrackingTimer;
+    int keyboardTrackingDelay = 0;
+
+    // Emissions during a button, wheel or scrub burst are coalesced to one per interval.
+    int emissionInterval = 0;
+    bool interacting = false;
+    bool emissionPending = false;
+    // Whether the current burst has emitted with inProgress, and so owes a final emission.
+    bool progressEmitted = false;
+    ValueChangeSource interactionSource = ProgrammaticChange;
+    T deadband{};
+    QBasicTimer emissionTimer;
     int spinClickTimerInterval = 100;
-    QBasicTimer spinClickThresholdTimer;
+    // Single steps per step of stepBy(), above 1 only while an auto-repeat tick
+    // takes more than INT_MAX steps.
+    quint64 repeatScale = 1;
     int spinClickThresholdTimerInterval = -1;
-    int acceleration = 0;
-    qreal effectiveSpinRepeatRate = 1;
     int wheelDeltaRemainder = 0;
 
+    WheelMode wheelMode = AngleDeltaWheel;
+    int wheelPixelRemainder = 0;
+    qint64 pendingWheelSteps = 0;
+    Qt::KeyboardModifiers wheelModifiers = Qt::NoModifier;
+    QBasicTimer wheelFlushTimer;
+    QBasicTimer wheelIdleTimer;
+    QElapsedTimer wheelClock;
+    // Wheel events further apart than this start a new burst.
+    static constexpr qint64 wheelBurstTimeout = 250;
+
+    // What caused the change being emitted, and the value consumers saw last.
+    ValueChangeSource changeSource = ProgrammaticChange;
+    T lastEmittedValue{};
+
     QExtraSpinBoxValidator<T> *validator = nullptr;
 
     QExtraSpinBoxPrivate(QAbstractSpinBox *qq)
@@ -220,9 +727,28 @@ public:
     {
     }
 
+    virtual ~QExtraSpinBoxPrivate()
+    {
+        QExtraSpinBoxRepeatDriver::stop(this);
+    }
+
     QString cleanText() const
     {
-        return stripped(q_edit()->displayText());
+        return stripped(displayText());
+    }
+
+    QString displayText() const
+    {
+        // With frame pacing the editor may lag behind the value until the next frame,
+        // the text is then formatted on demand and at most once per value.
+        if (!editUpdatePending) {
+            return q_edit()->displayText();
+        }
+        if (!pendingText.has_value() || pendingTextValue != value) {
+            pendingText = formattedText();
+            pendingTextValue = value;
+        }
+        return pendingText.value();
     }
 
     virtual void init()
@@ -233,10 +759,7 @@ public:
         validator = new QExtraSpinBoxValidator<T>(q, this);
         q_edit()->setValidator(validator);
 
-        QStyleOptionSpinBox opt;
-        q_initStyleOption(&opt);
-        spinClickTimerInterval = q->style()->styleHint(QStyle::SH_SpinBox_ClickAutoRepeatRate, &opt, q);
-        spinClickThresholdTimerInterval = q->style()->styleHint(QStyle::SH_SpinBox_ClickAutoRepeatThreshold, &opt, q);
+        updateStyleHints();
 
         q->setFocusPolicy(Qt::WheelFocus);
         q->setSizePolicy(QSizePolicy(QSizePolicy::Minimum, QSizePolicy::Fixed, QSizePolicy::SpinBox));
@@ -253,6 +776,8 @@ public:
         });
 
         updateEdit();
+        shownStepEnabled = q_stepEnabled();
+        lastEmittedValue = value;
     }
 
     bool specialValue() const
@@ -287,6 +812,7 @@ public:
         } else if (value == minimum && !q->specialValueText().isEmpty()) {
             updateEdit();
         }
+        updateStepEnabledControls();
 
         q->updateGeometry();
     }
@@ -314,6 +840,22 @@ public:
         }
     }
 
+    void setDecimals(int count)
+    {
+        // 10^decimals must fit T.
+        count = qBound(0, count, std::numeric_limits<T>::digits10);
+        if (count != decimals) {
+            decimals = count;
+            updateEdit();
+
+            cachedSizeHint = QSize();
+            cachedMinimumSizeHint = QSize();
+
+            Q_Q(QAbstractSpinBox);
+            q->updateGeometry();
+        }
+    }
+
     void setPrefix(const QString &value)
     {
         prefix = value;
@@ -337,6 +879,38 @@ public:
         q->updateGeometry();
     }
 
+    void setChromeCached(bool enable)
+    {
+        if (enable != chromeCached) {
+            chromeCached = enable;
+
+            Q_Q(QAbstractSpinBox);
+            q->update();
+        }
+    }
+
+    void setGlyphCached(bool enable)
+    {
+        if (enable != glyphCached) {
+            glyphCached = enable;
+            updateGlyphDisplay();
+        }
+    }
+
+    bool glyphDisplayActive() const
+    {
+        Q_Q(const QAbstractSpinBox);
+        return glyphCached && q->isReadOnly();
+    }
+
+    void setFramePaced(bool enable)
+    {
+        framePaced = enable;
+        if (!framePaced) {
+            flushEditUpdate();
+        }
+    }
+
     void setValue(T val, EmitPolicy ep, bool doUpdate = true)
     {
         Q_Q(QAbstractSpinBox);
@@ -345,12 +919,13 @@ public:
         value = bound(val);
         pendingEmit = false;
         cleared = false;
+        keyboardTrackingTimer.stop();
 
         if (doUpdate) {
             updateEdit();
         }
 
-        q->update();
+        updateStepEnabledControls();
 
         if (ep == AlwaysEmit || (ep == EmitIfChanged && old != value)) {
             emitSignals(ep, old);
@@ -364,9 +939,254 @@ public:
         if (!q->isGroupSeparatorShown()) {
             input.remove(q->locale().groupSeparator());
         }
+
+        // A number in range but not allowed snaps to the nearest allowed value.
+        if (restrictsToAllowed()) {
+            const std::optional<T> typed = parseNumber(stripped(input));
+            if (typed && *typed >= minimum && *typed <= maximum && !isAllowed(*typed)) {
+                input = prefix + textFromValue(nearestAllowed(*typed)) + suffix;
+            }
+        }
     }
 
-    void stepBy(int steps)
+    void setAccelerationFunction(const AccelerationFunction &function)
+    {
+        accelerationFunction = function;
+        accelerationCurve = CustomAcceleration;
+    }
+
+    void setAdaptiveSignificantDigits(int digits)
+    {
+        adaptiveSignificantDigits = qMax(1, digits);
+    }
+
+    void setAllowedValues(QList<T> values)
+    {
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        allowedValues = std::move(values);
+        clearCache();
+        if (const auto boundV = bound(value); boundV != value) {
+            setValue(boundV, EmitIfChanged);
+        } else {
+            updateStepEnabledControls();
+        }
+    }
+
+    // The allowed values within the range.
+    std::pair<typename QList<T>::const_iterator, typename QList<T>::const_iterator> allowedInRange() const
+    {
+        const auto first = std::lower_bound(allowedValues.cbegin(), allowedValues.cend(), minimum);
+        return {first, std::upper_bound(first, allowedValues.cend(), maximum)};
+    }
+
+    // Allowed values only restrict the value while one of them is in range. An
+    // empty list, or one with no value in range, allows every value in range.
+    bool restrictsToAllowed() const
+    {
+        const auto [first, last] = allowedInRange();
+        return first != last;
+    }
+
+    bool isAllowed(T v) const
+    {
+        const auto [first, last] = allowedInRange();
+        return first == last || std::binary_search(first, last, v);
+    }
+
+    // The allowed value in range closest to v, the lower one on ties. v itself
+    // when no allowed value is in range.
+    T nearestAllowed(T v) const
+    {
+        const auto [first, last] = allowedInRange();
+        if (first == last) {
+            return v;
+        }
+        const auto next = std::lower_bound(first, last, v);
+        if (next == first) {
+            return *first;
+        }
+        if (next == last) {
+            return *(last - 1);
+        }
+        if (*next == v) {
+            return v;
+        }
+        const T previous = *(next - 1);
+        // Unsigned distances, the difference of two far apart signed values may not fit T.
+        if constexpr (std::is_integral_v<T>) {
+            using U = magnitude_t<T>;
+            return static_cast<U>(static_cast<U>(*next) - static_cast<U>(v)) < static_cast<U>(static_cast<U>(v) - static_cast<U>(previous)) ? *next : previous;
+        } else {
+            return *next - v < v - previous ? *next : previous;
+        }
+    }
+
+    // Moves count allowed values up or down from v, by index. A v between two
+    // allowed values first moves to the one in the step direction. Stops at the
+    // ends of the range, or wraps around when wrapping. C is the count type of
+    // stepByCount(), so counts that do not fit a narrow T still count in full.
+    template<typename C>
+    T allowedStep(T v, C count, bool up) const
+    {
+        Q_Q(const QAbstractSpinBox);
+        const auto [first, last] = allowedInRange();
+        const qsizetype size = last - first;
+        if (size == 0) {
+            return v;
+        }
+
+        // Reduced to less than one lap, or to one lap without wrapping.
+        qsizetype n;
+        if constexpr (std::is_integral_v<C>) {
+            const auto laps = static_cast<C>(size);
+            n = static_cast<qsizetype>(q->wrapping() ? count % laps : qMin(count, laps));
+        } else {
+            const C laps = size;
+            n = static_cast<qsizetype>(static_cast<double>(q->wrapping() ? count % laps : qMin(count, laps)));
+        }
+
+        const auto at = std::lower_bound(first, last, v);
+        const bool member = at != last && *at == v;
+        qsizetype index = at - first;
+        if (up) {
+            index += n - (member ? 0 : 1);
+        } else {
+            index -= n;
+        }
+        if (q->wrapping()) {
+            index = (index % size + size) % size;
+        } else {
+            index = qBound<qsizetype>(0, index, size - 1);
+        }
+        return first[index];
+    }
+
+    void setStepFactor(T factor)
+    {
+        stepFactor = qMax<T>(2, factor);
+    }
+
+    // Moves to the next value with a single significant digit, so 8, 9, 10, 20, ... 90, 100.
+    T decadeStep(T v, bool up) const
+    {
+        using U = magnitude_t<T>;
+        const bool negative = v < 0;
+        const bool resultNegative = negative || (v == 0 && !up);
+
+        if constexpr (!std::is_integral_v<T>) {
+            const U magnitude = negative ? -v : v;
+            U next;
+            if (v == 0 || up != negative) {
+                const U decade = decadeOf(magnitude);
+                next = (magnitude / decade + 1) * decade;
+            } else {
+                const U decade = decadeOf(magnitude - 1);
+                next = (magnitude - 1) / decade * decade;
+            }
+            return resultNegative ? -next : next;
+        } else {
+            const U magnitude = negative ? U(0) - static_cast<U>(v) : static_cast<U>(v);
+
+            U next;
+            if (v == 0 || up != negative) {
+                const U decade = decadeOf(magnitude);
+                const U digit = magnitude / decade + 1;
+                next = digit > std::numeric_limits<U>::max() / decade ? std::numeric_limits<U>::max() : digit * decade;
+            } else {
+                // Towards zero, an off-grid value first snaps to its leading digit, so 120 steps down to 100.
+                const U decade = decadeOf<U>(magnitude - 1);
+                next = (magnitude - 1) / decade * decade;
+            }
+
+            if (!resultNegative) {
+                return next > static_cast<U>(std::numeric_limits<T>::max()) ? std::numeric_limits<T>::max() : static_cast<T>(next);
+            }
+            if constexpr (std::is_signed_v<T>) {
+                const U limit = U(0) - static_cast<U>(std::numeric_limits<T>::min());
+                return next >= limit ? std::numeric_limits<T>::min() : static_cast<T>(U(0) - next);
+            }
+            return 0;
+        }
+    }
+
+    // One step of the multiplicative and decade modes. Going up multiplies
+    // positive values and divides negative ones, crossing zero through singleStep.
+    T scaledStep(T v, bool up) const
+    {
+        if (stepMode == DecadeStep) {
+            return decadeStep(v, up);
+        }
+
+        if (v == 0) {
+            return up ? singleStep : valueSub(T{}, singleStep);
+        }
+        if ((v > 0) == up) {
+            return valueMul(v, stepFactor);
+        }
+        return v / stepFactor;
+    }
+
+    template<typename C>
+    T scaledValue(T v, C steps, bool up) const
+    {
+        // Any value is reached or saturated well within this many steps.
+        constexpr int maximumSteps = 1024;
+        const int count = steps < C(maximumSteps) ? static_cast<int>(static_cast<double>(steps)) : maximumSteps;
+        for (int i = 0; i < count; ++i) {
+            const T next = scaledStep(v, up);
+            if (next == v) {
+                break;
+            }
+            v = next;
+        }
+        return v;
+    }
+
+    void setScrubFunction(const ScrubFunction &function)
+    {
+        scrubFunction = function;
+        scrubCurve = CustomAcceleration;
+    }
+
+    void stepBy(qint64 steps)
+    {
+        const quint64 count = steps < 0 ? 0 - static_cast<quint64>(steps) : static_cast<quint64>(steps);
+        const quint64 limit = std::numeric_limits<quint64>::max() / repeatScale;
+        stepByCount(count > limit ? std::numeric_limits<quint64>::max() : count * repeatScale, steps >= 0);
+    }
+
+    // Moves count steps of the current step mode. C is quint64 for stepBy()
+    // counts and magnitude_t<T> for counts of the value type.
+    template<typename C>
+    void stepByCount(C count, bool up)
+    {
+        const qint64 direction = count == C(0) ? 0 : (up ? 1 : -1);
+        applyStep([this, count, up, direction](T old, bool digitStepping) {
+            if (restrictsToAllowed()) {
+                return allowedStep(value, count, up);
+            }
+            if (stepMode != AdditiveStep && !digitStepping) {
+                return bound(scaledValue(value, count, up), old, direction);
+            }
+
+            T singleStep = this->singleStep;
+            if (digitStepping) {
+                // Keep the cursor on the same digit when the number gains or loses digits.
+                cursorFromEndOnEditUpdate = q_edit()->displayText().size() - q_edit()->cursorPosition();
+                singleStep = cursorDigitStep();
+            } else if (stepType == QAbstractSpinBox::StepType::AdaptiveDecimalStepType) {
+                singleStep = calculateAdaptiveDecimalStep(direction);
+            }
+            return bound(steppedValue(value, singleStep, stepCount(count), up).value_or(value), old, direction);
+        });
+    }
+
+    // Everything a step does around computing the new value: interpreting
+    // pending edits, bounding, emitting, frame pacing and select-on-step.
+    // next gets the value from before the edits were interpreted.
+    template<typename F>
+    void applyStep(F &&next)
     {
         Q_Q(QAbstractSpinBox);
 
@@ -384,26 +1204,93 @@ public:
             }
         }
 
+        const bool digitStepping = cursorDigitStepping && !specialValue();
         if (!dontstep) {
-            T singleStep;
-            switch (stepType) {
-            case QAbstractSpinBox::StepType::AdaptiveDecimalStepType:
-                singleStep = calculateAdaptiveDecimalStep(steps);
-                break;
-            default:
-                singleStep = this->singleStep;
-            }
-            if (steps >= 0) {
-                setValue(bound(valueAdd(value, valueMul(singleStep, static_cast<T>(steps))), old, steps), e);
-            } else {
-                setValue(bound(valueSub(value, valueMul(singleStep, static_cast<T>(steps * -1))), old, steps), e);
+            setValue(next(old, digitStepping), e, !framePaced);
+            if (framePaced) {
+                scheduleEditUpdate();
             }
         } else if (e == AlwaysEmit) {
             emitSignals(e, old);
         }
-        if (q->style()->styleHint(QStyle::SH_SpinBox_SelectOnStep, nullptr, q, nullptr)) {
-            q->selectAll();
+        if (selectOnStep && !digitStepping) {
+            if (editUpdatePending) {
+                selectAllOnEditUpdate = true;
+            } else {
+                q->selectAll();
+            }
+        }
+    }
+
+    // v moved count steps of step under the overflow policy, or nothing when
+    // the policy rejects the step.
+    std::optional<T> steppedValue(T v, T step, magnitude_t<T> count, bool up) const
+    {
+        if constexpr (!std::is_integral_v<T>) {
+            return up ? v + step * count : v - step * count;
+        } else {
+            T r{};
+            const OverflowPolicy policy = effectiveOverflowPolicy();
+            if (!checkedStep(v, step, count, up, &r) || policy == WrapOnOverflow) {
+                return r;
+            }
+            if (policy == RejectOnOverflow) {
+                return std::nullopt;
+            }
+            return stepLimit(step, up);
+        }
+    }
+
+    // Wrapping modulo 2^N only applies when the range is the whole type. Within
+    // a narrower range the wrapped value would be clamped to the opposite end
+    // of the range, so such a range saturates instead.
+    OverflowPolicy effectiveOverflowPolicy() const
+    {
+        if constexpr (std::is_integral_v<T>) {
+            if (overflowPolicy == WrapOnOverflow && (minimum != std::numeric_limits<T>::min() || maximum != std::numeric_limits<T>::max())) {
+                return SaturateOnOverflow;
+            }
         }
+        return overflowPolicy;
+    }
+
+    // The magnitude of a step count. stepBy() counts that do not fit a narrow T
+    // are reduced modulo 2^N when wrapping and saturated otherwise.
+    template<typename C>
+    magnitude_t<T> stepCount(C count) const
+    {
+        if constexpr (std::is_same_v<C, magnitude_t<T>>) {
+            return count;
+        } else if constexpr (std::is_integral_v<T> && std::numeric_limits<magnitude_t<T>>::digits < std::numeric_limits<quint64>::digits) {
+            if (effectiveOverflowPolicy() != WrapOnOverflow && count > std::numeric_limits<magnitude_t<T>>::max()) {
+                return std::numeric_limits<magnitude_t<T>>::max();
+            }
+            return static_cast<magnitude_t<T>>(count);
+        } else {
+            return count;
+        }
+    }
+
+    // A negative count steps the other way. Takes the same path as stepBy(),
+    // so a wrapping step first stops at the limit and only wraps from there.
+    void stepByWide(T count, bool up)
+    {
+        using U = magnitude_t<T>;
+        const bool negative = count < 0;
+        if constexpr (!std::is_integral_v<T>) {
+            stepByCount(negative ? -count : count, up != negative);
+        } else {
+            stepByCount(negative ? U(0) - static_cast<U>(count) : static_cast<U>(count), up != negative);
+        }
+    }
+
+    // Bounded like a step towards target, so out of range targets stop at the
+    // limit, and only wrap when wrapping and the value is already there.
+    void stepTo(T target)
+    {
+        applyStep([this, target](T old, bool) {
+            return bound(target, old, target < old ? -1 : (target > old ? 1 : 0));
+        });
     }
 
     QValidator::State validateImpl(QString &input, int &pos) const
@@ -413,6 +1300,22 @@ public:
         return state;
     }
 
+    // Long enough for any value of T with sign and group separators. Unlimited
+    // types get the width of a 128-bit value, longer texts are cut for the hint.
+    static constexpr qsizetype hintTextLength = std::numeric_limits<T>::is_specialized
+        ? std::numeric_limits<T>::digits10 + 2 + (std::numeric_limits<T>::digits10 + 1) / 3
+        : 52;
+
+    QVariant accessibleValue() const
+    {
+        // QVariant has no 128-bit or big integer constructors.
+        if constexpr (!std::is_integral_v<T> || std::numeric_limits<T>::digits > std::numeric_limits<quint64>::digits) {
+            return QVariant(static_cast<double>(value));
+        } else {
+            return QVariant::fromValue(value);
+        }
+    }
+
     QSize minimumSizeHint() const
     {
         Q_Q(const QAbstractSpinBox);
@@ -427,11 +1330,11 @@ public:
             QString s;
             QString fixedContent = prefix + u' ';
             s = textFromValue(minimum);
-            s.truncate(18);
+            s.truncate(hintTextLength);
             s += fixedContent;
             w = qMax(w, fm.horizontalAdvance(s));
             s = textFromValue(maximum);
-            s.truncate(18);
+            s.truncate(hintTextLength);
             s += fixedContent;
             w = qMax(w, fm.horizontalAdvance(s));
 
@@ -462,11 +1365,11 @@ public:
             QString s;
             QString fixedContent = prefix + suffix + u' ';
             s = textFromValue(minimum);
-            s.truncate(18);
+            s.truncate(hintTextLength);
             s += fixedContent;
             w = qMax(w, fm.horizontalAdvance(s));
             s = textFromValue(maximum);
-            s.truncate(18);
+            s.truncate(hintTextLength);
             s += fixedContent;
             w = qMax(w, fm.horizontalAdvance(s));
 
@@ -496,8 +1399,7 @@ public:
         QString str;
 
         if (displayIntegerBase != 10) {
-            const auto prefix = value < 0 ? "-"_L1 : ""_L1;
-            str = prefix + QString::number(qAbs(value), displayIntegerBase);
+            str = integerToString(value, displayIntegerBase);
         } else {
             Q_Q(const QAbstractSpinBox);
             QLocale loc = q->locale();
@@ -505,12 +1407,26 @@ public:
                 loc.setNumberOptions(loc.numberOptions() & ~QLocale::OmitGroupSeparator);
             else
                 loc.setNumberOptions(loc.numberOptions() | QLocale::OmitGroupSeparator);
-            str = loc.toString(value);
+            if constexpr (std::is_integral_v<T>) {
+                str = decimals > 0 ? localeToFixed(loc, numberGrouping(), value, decimals) : localeToString(loc, numberGrouping(), value);
+            } else {
+                str = localeToString(loc, numberGrouping(), value);
+            }
         }
 
         return str;
     }
 
+    T localeToValue(const QLocale &locale, const QString &text, bool *ok) const
+    {
+        if constexpr (std::is_integral_v<T>) {
+            if (decimals > 0) {
+                return fixedToInteger<T>(locale, text, decimals, ok);
+            }
+        }
+        return localeToInteger<T>(locale, text, ok);
+    }
+
     T valueFromTextImpl(const QString &text) const
     {
         QString copy = text;
@@ -519,6 +1435,8 @@ public:
         return validateAndInterpret(copy, pos, state);
     }
 
+    // Built from scratch on every call; only the style hints are snapshotted,
+    // the base option itself is not cached.
     void initStyleOptionImpl(QStyleOptionSpinBox *option) const
     {
         if (!option) {
@@ -530,7 +1448,7 @@ public:
         option->activeSubControls = QStyle::SC_None;
         option->buttonSymbols = q->buttonSymbols();
         option->subControls = QStyle::SC_SpinBoxEditField;
-        if (q->style()->styleHint(QStyle::SH_SpinBox_ButtonsInsideFrame, nullptr, q)) {
+        if (buttonsInsideFrame) {
             option->subControls |= QStyle::SC_SpinBoxFrame;
         }
         if (q->buttonSymbols() != QAbstractSpinBox::NoButtons) {
@@ -548,9 +1466,7 @@ public:
             option->activeSubControls = hoverControl;
         }
 
-        option->stepEnabled = q->style()->styleHint(QStyle::SH_SpinControls_DisableOnBounds, nullptr, q)
-            ? q_stepEnabled()
-            : (QAbstractSpinBox::StepDownEnabled | QAbstractSpinBox::StepUpEnabled);
+        option->stepEnabled = disableOnBounds ? q_stepEnabled() : (QAbstractSpinBox::StepDownEnabled | QAbstractSpinBox::StepUpEnabled);
 
         option->frame = q->hasFrame();
     }
@@ -565,6 +1481,16 @@ public:
             return QAbstractSpinBox::StepEnabled(QAbstractSpinBox::StepUpEnabled | QAbstractSpinBox::StepDownEnabled);
         }
         QAbstractSpinBox::StepEnabled ret = QAbstractSpinBox::StepNone;
+        if (restrictsToAllowed()) {
+            const auto [first, last] = allowedInRange();
+            if (std::upper_bound(first, last, value) != last) {
+                ret |= QAbstractSpinBox::StepUpEnabled;
+            }
+            if (std::lower_bound(first, last, value) != first) {
+                ret |= QAbstractSpinBox::StepDownEnabled;
+            }
+            return ret;
+        }
         if (value < maximum) {
             ret |= QAbstractSpinBox::StepUpEnabled;
         }
@@ -580,12 +1506,21 @@ public:
         case QEvent::FontChange:
         case QEvent::StyleChange:
             cachedSizeHint = cachedMinimumSizeHint = QSize();
+            cachedSubControlRects.valid = false;
             break;
         case QEvent::ApplicationLayoutDirectionChange:
         case QEvent::LayoutDirectionChange:
+            cachedSubControlRects.valid = false;
             updateEditFieldGeometry();
             break;
+        case QEvent::Paint:
+            // setWrapping() and subclass overrides of stepEnabled() send no
+            // event, so catch up with them whenever the widget is drawn or hovered.
+            updateStepEnabledControls();
+            break;
         case QEvent::HoverEnter:
+            updateStepEnabledControls();
+            Q_FALLTHROUGH();
         case QEvent::HoverLeave:
         case QEvent::HoverMove:
             updateHoverControl(static_cast<const QHoverEvent *>(event)->position().toPoint());
@@ -622,22 +1557,27 @@ public:
         Q_Q(const QAbstractSpinBox);
         switch (event->type()) {
         case QEvent::StyleChange:
-            spinClickTimerInterval = q->style()->styleHint(QStyle::SH_SpinBox_ClickAutoRepeatRate, nullptr, q);
-            spinClickThresholdTimerInterval = q->style()->styleHint(QStyle::SH_SpinBox_ClickAutoRepeatThreshold, nullptr, q);
+            updateStyleHints();
             if (q_edit()) {
-                q_edit()->setFrame(!q->style()->styleHint(QStyle::SH_SpinBox_ButtonsInsideFrame, nullptr, q));
+                q_edit()->setFrame(!buttonsInsideFrame);
             }
-            stepModifier = static_cast<Qt::KeyboardModifier>(q->style()->styleHint(QStyle::SH_SpinBox_StepModifier, nullptr, q));
             reset();
             updateEditFieldGeometry();
             break;
         case QEvent::LocaleChange:
+            // Also sent by setLocale() and by a parent's locale change.
+            cachedGrouping.reset();
             updateEdit();
             break;
+        case QEvent::ReadOnlyChange:
+            updateGlyphDisplay();
+            updateStepEnabledControls();
+            break;
         case QEvent::EnabledChange:
             if (!q->isEnabled()) {
                 reset();
             }
+            updateStepEnabledControls();
             break;
         case QEvent::ActivationChange:
             if (!q->isActiveWindow()) {
@@ -708,6 +1648,7 @@ public:
             const QAction *action = menu->exec(pos);
             delete static_cast<QMenu *>(menu);
             if (that && action) {
+                const auto sourceScope = changeSourceScope(MouseChange);
                 if (action == up) {
                     q->stepBy(1);
                 } else if (action == down) {
@@ -724,6 +1665,7 @@ public:
     void focusOutEvent(QFocusEvent *event)
     {
         Q_Q(QAbstractSpinBox);
+        const auto sourceScope = changeSourceScope(KeyboardChange);
 
         if (pendingEmit) {
             interpret(EmitIfChanged);
@@ -742,6 +1684,7 @@ public:
 
     void hideEvent(QHideEvent *event)
     {
+        const auto sourceScope = changeSourceScope(KeyboardChange);
         reset();
         if (pendingEmit) {
             interpret(EmitIfChanged);
@@ -751,6 +1694,7 @@ public:
     void keyPressEvent(QKeyEvent *event)
     {
         Q_Q(QAbstractSpinBox);
+        const auto sourceScope = changeSourceScope(KeyboardChange);
 
         keyboardModifiers = event->modifiers();
 
@@ -789,19 +1733,20 @@ public:
             if (!up) {
                 steps *= -1;
             }
-            if (q->style()->styleHint(QStyle::SH_SpinBox_AnimateButton, nullptr, q)) {
-                buttonState = static_cast<Button>(Keyboard | (up ? Up : Down));
-            }
-            if (!spinClickTimer.isActive()) {
-                stepBy(steps);
-            }
             if (event->isAutoRepeat() && !isPgUpOrDown) {
-                if (!spinClickThresholdTimer.isActive() && !spinClickTimer.isActive()) {
-                    updateState(up, true);
+                // Auto-repeat events only keep the scheduler running, it decides how far to step.
+                if (!QExtraSpinBoxRepeatDriver::isActive(this) || !(buttonState & (up ? Up : Down))) {
+                    startKeyboardRepeat(up);
+                }
+            } else {
+                if (animateButton) {
+                    buttonState = static_cast<Button>(Keyboard | (up ? Up : Down));
+                    updateButtonControls();
                 }
+                stepBy(steps);
             }
 #if QT_CONFIG(accessibility)
-            QAccessibleValueChangeEvent event(q, value);
+            QAccessibleValueChangeEvent event(q, accessibleValue());
             QAccessible::updateAccessibility(&event);
 #endif
             return;
@@ -890,6 +1835,7 @@ public:
             break;
         }
 
+        flushEditUpdate();
         q_edit()->event(event);
         if (!q_edit()->text().isEmpty()) {
             cleared = false;
@@ -916,8 +1862,25 @@ public:
         keyboardModifiers = event->modifiers();
         updateHoverControl(event->position().toPoint());
 
+        if (scrubEnabled && (buttonState & Mouse)) {
+            const int distance = event->position().toPoint().y() - scrubOrigin.y();
+            if (!scrubbing && qAbs(distance) >= QGuiApplication::styleHints()->startDragDistance()) {
+                startScrub();
+            }
+            if (scrubbing) {
+                scrubDistance = distance;
+                const Button direction = distance < 0 ? Up : Down;
+                if (!(buttonState & direction)) {
+                    buttonState = static_cast<Button>(Mouse | direction);
+                    updateButtonControls();
+                }
+                event->accept();
+                return;
+            }
+        }
+
         // If we have a timer ID, update the state
-        if (spinClickTimer.isActive() && q->buttonSymbols() != QAbstractSpinBox::NoButtons) {
+        if ((buttonState & Mouse) && QExtraSpinBoxRepeatDriver::isRepeating(this) && q->buttonSymbols() != QAbstractSpinBox::NoButtons) {
             const QAbstractSpinBox::StepEnabled se = q_stepEnabled();
             if ((se & QAbstractSpinBox::StepUpEnabled) && hoverControl == QStyle::SC_SpinBoxUp) {
                 updateState(true);
@@ -945,6 +1908,7 @@ public:
 
         const QAbstractSpinBox::StepEnabled se =
             (q->buttonSymbols() == QAbstractSpinBox::NoButtons) ? QAbstractSpinBox::StepEnabled(QAbstractSpinBox::StepNone) : q_stepEnabled();
+        scrubOrigin = event->position().toPoint();
         if ((se & QAbstractSpinBox::StepUpEnabled) && hoverControl == QStyle::SC_SpinBoxUp) {
             updateState(true);
         } else if ((se & QAbstractSpinBox::StepDownEnabled) && hoverControl == QStyle::SC_SpinBoxDown) {
@@ -960,14 +1924,47 @@ public:
         if ((buttonState & Mouse) != 0) {
             reset();
         }
-        event->accept();
+        event->accept();
+    }
+
+    bool paintEvent(QPaintEvent *event)
+    {
+        const bool drawText = glyphDisplayActive();
+        if (!chromeCached && !drawText) {
+            return false;
+        }
+
+        Q_Q(QAbstractSpinBox);
+        QStyleOptionSpinBox opt;
+        q_initStyleOption(&opt);
+        QPainter painter(q);
+        if (chromeCached) {
+            QExtraSpinBoxChromeRenderer::draw(&painter, q, opt);
+        } else {
+            q->style()->drawComplexControl(QStyle::CC_SpinBox, &opt, &painter, q);
+        }
+
+        if (drawText) {
+            // The hidden editor still holds the formatted text, so no formatting happens here.
+            const QString text = q_edit()->displayText();
+            painter.setPen(q->palette().color(q->isEnabled() ? QPalette::Normal : QPalette::Disabled, QPalette::Text));
+            auto *glyphs = QExtraSpinBoxGlyphCache::forFont(q->font());
+            if (specialValue()) {
+                glyphs->draw(&painter, q_edit()->geometry(), q->alignment(), text, {}, {});
+            } else {
+                const QStringView view(text);
+                const qsizetype numberSize = qMax<qsizetype>(0, view.size() - prefix.size() - suffix.size());
+                glyphs->draw(&painter, q_edit()->geometry(), q->alignment(), prefix, view.mid(prefix.size(), numberSize), suffix);
+            }
+        }
+        return true;
     }
 
     void resizeEvent(QResizeEvent *event)
     {
-        Q_Q(QAbstractSpinBox);
+        // The resize itself already repaints the whole widget.
+        cachedSubControlRects.valid = false;
         updateEditFieldGeometry();
-        q->update();
     }
 
     void showEvent(QShowEvent *event)
@@ -983,67 +1980,87 @@ public:
 
     void timerEvent(QTimerEvent *event)
     {
-        Q_Q(QAbstractSpinBox);
-
-        bool doStep = false;
-        if (event->id() == spinClickThresholdTimer.id()) {
-            spinClickThresholdTimer.stop();
-            effectiveSpinRepeatRate = buttonState & Keyboard ? QGuiApplication::styleHints()->keyboardAutoRepeatRateF() : spinClickTimerInterval;
-            spinClickTimer.start(effectiveSpinRepeatRate, q);
-            doStep = true;
-        } else if (event->id() == spinClickTimer.id()) {
-            if (q->isAccelerated()) {
-                acceleration = acceleration + (int)(effectiveSpinRepeatRate * 0.05);
-                auto interval = int(effectiveSpinRepeatRate - acceleration) * 1ms;
-                if (interval >= 10ms) {
-                    spinClickTimer.start(interval, q);
-                }
+        if (event->id() == displayUpdateTimer.id()) {
+            flushEditUpdate();
+        } else if (event->id() == keyboardTrackingTimer.id()) {
+            keyboardTrackingTimer.stop();
+            trackEditorText();
+        } else if (event->id() == wheelFlushTimer.id()) {
+            flushWheelSteps();
+        } else if (event->id() == wheelIdleTimer.id()) {
+            wheelIdleTimer.stop();
+            if (buttonState == None) {
+                finishInteraction();
             }
-            doStep = true;
-        }
-
-        if (doStep) {
-            const bool increaseStepRate = keyboardModifiers & stepModifier;
-            const auto st = q_stepEnabled();
-            if (buttonState & Up) {
-                if (!(st & QAbstractSpinBox::StepUpEnabled)) {
-                    reset();
-                } else {
-                    q->stepBy(increaseStepRate ? 10 : 1);
-                }
-            } else if (buttonState & Down) {
-                if (!(st & QAbstractSpinBox::StepDownEnabled)) {
-                    reset();
-                } else {
-                    q->stepBy(increaseStepRate ? -10 : -1);
-                }
+        } else if (event->id() == emissionTimer.id()) {
+            if (emissionPending && !withinDeadband()) {
+                const auto sourceScope = changeSourceScope(interactionSource);
+                emissionPending = false;
+                emitValueChanged();
+            } else {
+                emissionPending = false;
+                emissionTimer.stop();
             }
-            return;
         }
     }
 
 #if QT_CONFIG(wheelevent)
     void wheelEvent(QWheelEvent *event)
     {
+        const auto sourceScope = changeSourceScope(WheelChange);
+        bool horizontal = false;
 #ifdef Q_OS_MACOS
         // If the event comes from a real mouse wheel, rather than a track pad
         // (Qt::MouseEventSynthesizedBySystem), the shift modifier changes the
         // scroll orientation to horizontal.
         // Convert horizontal events back to vertical whilst shift is held.
-        if ((event->modifiers() & Qt::ShiftModifier) && event->source() == Qt::MouseEventNotSynthesized) {
-            wheelDeltaRemainder += event->angleDelta().x();
-        } else {
-            wheelDeltaRemainder += event->angleDelta().y();
-        }
-#else
-        wheelDeltaRemainder += event->angleDelta().y();
+        horizontal = (event->modifiers() & Qt::ShiftModifier) && event->source() == Qt::MouseEventNotSynthesized;
 #endif
+        const int angleDelta = horizontal ? event->angleDelta().x() : event->angleDelta().y();
+
+        if (wheelMode == PrecisionWheel) {
+            // Pixel deltas from touchpads are finer than the 120 units of a wheel notch.
+            constexpr int pixelsPerStep = 15;
+
+            Q_Q(QAbstractSpinBox);
+            const QPoint pixelDelta = event->pixelDelta();
+            if (!pixelDelta.isNull()) {
+                wheelPixelRemainder += horizontal ? pixelDelta.x() : pixelDelta.y();
+                const int steps = wheelPixelRemainder / pixelsPerStep;
+                wheelPixelRemainder -= steps * pixelsPerStep;
+                pendingWheelSteps += steps;
+            } else {
+                wheelDeltaRemainder += angleDelta;
+                const int steps = wheelDeltaRemainder / 120;
+                wheelDeltaRemainder -= steps * 120;
+                pendingWheelSteps += steps;
+            }
+            wheelModifiers = event->modifiers();
+
+            // Merge the burst of events delivered in one event loop iteration into one step.
+            if (!wheelFlushTimer.isActive()) {
+                wheelFlushTimer.start(0ms, q);
+            }
+            event->accept();
+            return;
+        }
+
+        wheelDeltaRemainder += angleDelta;
         const int steps = wheelDeltaRemainder / 120;
         wheelDeltaRemainder -= steps * 120;
+        event->accept();
+        // A partial notch from a high-resolution wheel only accumulates.
+        if (steps == 0) {
+            return;
+        }
         if (q_stepEnabled() & (steps > 0 ? QAbstractSpinBox::StepUpEnabled : QAbstractSpinBox::StepDownEnabled)) {
+            beginInteraction();
             stepBy(event->modifiers() & stepModifier ? steps * 10 : steps);
+            if (buttonState == None) {
+                Q_Q(QAbstractSpinBox);
+                wheelIdleTimer.start(wheelBurstTimeout * 1ms, q);
+            }
         }
-        event->accept();
     }
 #endif // QT_CONFIG(wheelevent)
 
@@ -1061,6 +2078,8 @@ protected:
     virtual T valueFromText(const QString &text) const = 0;
 
     virtual void emitSignalsImpl() = 0;
+    // Emits only valueChangedDetailed for the current value, as no longer in progress.
+    virtual void emitFinishedImpl() = 0;
 
 private:
     QString stripped(const QString &t, int *pos = nullptr) const
@@ -1096,10 +2115,63 @@ private:
         return text.toString();
     }
 
-    void updateEdit()
+    void updateStyleHints()
+    {
+        // Style hints are only read here, style sheet styles make each query costly.
+        Q_Q(QAbstractSpinBox);
+        const QStyle *style = q->style();
+        spinClickTimerInterval = style->styleHint(QStyle::SH_SpinBox_ClickAutoRepeatRate, nullptr, q);
+        spinClickThresholdTimerInterval = style->styleHint(QStyle::SH_SpinBox_ClickAutoRepeatThreshold, nullptr, q);
+        stepModifier = static_cast<Qt::KeyboardModifier>(style->styleHint(QStyle::SH_SpinBox_StepModifier, nullptr, q));
+        selectOnStep = style->styleHint(QStyle::SH_SpinBox_SelectOnStep, nullptr, q);
+        animateButton = style->styleHint(QStyle::SH_SpinBox_AnimateButton, nullptr, q);
+        buttonsInsideFrame = style->styleHint(QStyle::SH_SpinBox_ButtonsInsideFrame, nullptr, q);
+        disableOnBounds = style->styleHint(QStyle::SH_SpinControls_DisableOnBounds, nullptr, q);
+    }
+
+    QString formattedText() const
+    {
+        Q_Q(const QAbstractSpinBox);
+        return specialValue() ? q->specialValueText() : prefix + textFromValue(value) + suffix;
+    }
+
+    std::chrono::milliseconds frameInterval() const
+    {
+        Q_Q(const QAbstractSpinBox);
+        const QScreen *screen = q->screen();
+        const qreal refreshRate = screen && screen->refreshRate() > 0 ? screen->refreshRate() : 60;
+        return qMax(1, qRound(1000 / refreshRate)) * 1ms;
+    }
+
+    void scheduleEditUpdate()
     {
         Q_Q(QAbstractSpinBox);
-        const QString newText = specialValue() ? q->specialValueText() : prefix + textFromValue(value) + suffix;
+        editUpdatePending = true;
+        if (!displayUpdateTimer.isActive()) {
+            displayUpdateTimer.start(frameInterval(), Qt::PreciseTimer, q);
+        }
+    }
+
+    void flushEditUpdate()
+    {
+        if (editUpdatePending) {
+            updateEdit();
+            if (selectAllOnEditUpdate) {
+                Q_Q(QAbstractSpinBox);
+                q->selectAll();
+            }
+        }
+        selectAllOnEditUpdate = false;
+    }
+
+    void updateEdit()
+    {
+        editUpdatePending = false;
+        displayUpdateTimer.stop();
+        const qsizetype cursorFromEnd = std::exchange(cursorFromEndOnEditUpdate, -1);
+        pendingText.reset();
+
+        const QString newText = formattedText();
         if (newText == q_edit()->displayText() || cleared) {
             return;
         }
@@ -1107,6 +2179,10 @@ private:
         const bool empty = q_edit()->text().isEmpty();
         int cursor = q_edit()->cursorPosition();
         int selsize = q_edit()->selectedText().size();
+        if (cursorFromEnd >= 0) {
+            cursor = static_cast<int>(newText.size() - cursorFromEnd);
+            selsize = 0;
+        }
         const QSignalBlocker blocker(q_edit());
         q_edit()->setText(newText);
 
@@ -1119,9 +2195,32 @@ private:
                 q_edit()->setCursorPosition(empty ? prefix.size() : cursor);
             }
         }
+
+        // The editor repaints itself, only text drawn from the glyph cache is ours.
+        if (glyphDisplayActive()) {
+            updateSubControl(QStyle::SC_SpinBoxEditField);
+        }
+    }
+
+    void updateGlyphDisplay()
+    {
+        // While the text is drawn from the glyph cache the editor is only kept
+        // for its text, so that text() and cleanText() stay valid.
+        Q_Q(QAbstractSpinBox);
+        q_edit()->setVisible(!glyphDisplayActive());
         q->update();
     }
 
+    // Grouping sizes of the widget's locale, probed once per locale.
+    const LocaleGrouping &numberGrouping() const
+    {
+        Q_Q(const QAbstractSpinBox);
+        if (!cachedGrouping) {
+            cachedGrouping = localeGrouping(q->locale());
+        }
+        return *cachedGrouping;
+    }
+
     void clearCache()
     {
         cachedValue.reset();
@@ -1129,20 +2228,100 @@ private:
         cachedState = QValidator::Acceptable;
     }
 
-    void reset()
+    void reset(bool endInteraction = true)
     {
         Q_Q(QAbstractSpinBox);
 
+        const Button lastButtonState = buttonState;
         buttonState = None;
+        scrubbing = false;
+        scrubDistance = 0;
         if (q) {
-            spinClickTimer.stop();
-            spinClickThresholdTimer.stop();
-            acceleration = 0;
-            q->update();
+            // Show the exact final value as soon as the interaction ends.
+            flushEditUpdate();
+            QExtraSpinBoxRepeatDriver::stop(this);
+            if (lastButtonState != None) {
+                updateButtonControls();
+            }
+            if (endInteraction) {
+                finishInteraction();
+            }
+        }
+    }
+
+    const SubControlRects &subControlRects() const
+    {
+        Q_Q(const QAbstractSpinBox);
+
+        // Button symbols and frame have no change event, so they are compared directly.
+        SubControlRects &rects = cachedSubControlRects;
+        if (!rects.valid || rects.size != q->size() || rects.buttonSymbols != q->buttonSymbols() || rects.hasFrame != q->hasFrame()) {
+            QStyleOptionSpinBox opt;
+            q_initStyleOption(&opt);
+            opt.subControls = QStyle::SC_All;
+
+            const QStyle *style = q->style();
+            rects.up = style->subControlRect(QStyle::CC_SpinBox, &opt, QStyle::SC_SpinBoxUp, q);
+            rects.down = style->subControlRect(QStyle::CC_SpinBox, &opt, QStyle::SC_SpinBoxDown, q);
+            rects.frame = style->subControlRect(QStyle::CC_SpinBox, &opt, QStyle::SC_SpinBoxFrame, q);
+            rects.editField = style->subControlRect(QStyle::CC_SpinBox, &opt, QStyle::SC_SpinBoxEditField, q);
+            rects.size = q->size();
+            rects.buttonSymbols = q->buttonSymbols();
+            rects.hasFrame = q->hasFrame();
+            rects.valid = true;
+        }
+        return rects;
+    }
+
+    QRect subControlRect(QStyle::SubControl control) const
+    {
+        const SubControlRects &rects = subControlRects();
+        switch (control) {
+        case QStyle::SC_SpinBoxUp:
+            return rects.up;
+        case QStyle::SC_SpinBoxDown:
+            return rects.down;
+        case QStyle::SC_SpinBoxFrame:
+            return rects.frame;
+        case QStyle::SC_SpinBoxEditField:
+            return rects.editField;
+        default:
+            return QRect();
+        }
+    }
+
+    void updateSubControl(QStyle::SubControl control)
+    {
+        Q_Q(QAbstractSpinBox);
+        q->update(subControlRect(control));
+    }
+
+    void updateButtonControls()
+    {
+        // Pressed state is drawn on the buttons, which may share the frame.
+        Q_Q(QAbstractSpinBox);
+        if (q->buttonSymbols() != QAbstractSpinBox::NoButtons) {
+            updateSubControl(QStyle::SC_SpinBoxUp);
+            updateSubControl(QStyle::SC_SpinBoxDown);
+        }
+    }
+
+    void updateStepEnabledControls()
+    {
+        const QAbstractSpinBox::StepEnabled stepEnabled = q_stepEnabled();
+        // Buttons are only drawn disabled when the style asks for it.
+        const QAbstractSpinBox::StepEnabled changed = disableOnBounds ? (stepEnabled ^ shownStepEnabled) : QAbstractSpinBox::StepNone;
+        shownStepEnabled = stepEnabled;
+
+        if (changed & QAbstractSpinBox::StepUpEnabled) {
+            updateSubControl(QStyle::SC_SpinBoxUp);
+        }
+        if (changed & QAbstractSpinBox::StepDownEnabled) {
+            updateSubControl(QStyle::SC_SpinBoxDown);
         }
     }
 
-    T bound(T value, std::optional<T> old = {}, int steps = 0) const
+    T bound(T value, std::optional<T> old = {}, qint64 steps = 0) const
     {
         Q_Q(const QAbstractSpinBox);
         if (!q->wrapping() || steps == 0 || !old.has_value()) {
@@ -1165,15 +2344,116 @@ private:
             }
         }
 
+        if (restrictsToAllowed()) {
+            value = nearestAllowed(value);
+        }
         return value;
     }
 
-    void emitSignals(EmitPolicy ep, const QVariant &old)
+    void emitSignals(EmitPolicy ep, T old)
     {
         if (ep != NeverEmit) {
             pendingEmit = false;
             if (ep == AlwaysEmit || value != old) {
-                emitSignalsImpl();
+                if (interacting && withinDeadband()) {
+                    return;
+                } else if (interacting && emissionInterval != 0) {
+                    coalesceEmission();
+                } else {
+                    emitValueChanged();
+                }
+            }
+        }
+    }
+
+    void coalesceEmission()
+    {
+        // The first change of a burst is emitted right away, later ones at most once per interval.
+        if (emissionTimer.isActive()) {
+            emissionPending = true;
+        } else {
+            Q_Q(QAbstractSpinBox);
+            emitValueChanged();
+            emissionTimer.start(emissionInterval > 0 ? emissionInterval * 1ms : frameInterval(), Qt::PreciseTimer, q);
+        }
+    }
+
+    void beginInteraction()
+    {
+        if (!interacting) {
+            interacting = true;
+            interactionSource = changeSource;
+        }
+    }
+
+    void finishInteraction()
+    {
+        if (!interacting) {
+            return;
+        }
+        interacting = false;
+        wheelIdleTimer.stop();
+        emissionTimer.stop();
+        emissionPending = false;
+        // A burst always ends by emitting the value consumers have not seen yet, even when it went back
+        // to where the burst started. When they have, only the detailed signal reports that it is final.
+        const auto sourceScope = changeSourceScope(interactionSource);
+        if (value != lastEmittedValue) {
+            emitValueChanged();
+        } else if (progressEmitted) {
+            emitFinishedImpl();
+        }
+        progressEmitted = false;
+    }
+
+    bool withinDeadband() const
+    {
+        if (!(deadband > 0)) {
+            return false;
+        }
+        // The distance as a magnitude is exact up to the limits, where saturated bounds
+        // would put a small move onto the limit outside the band.
+        using U = magnitude_t<T>;
+        const U distance = value < lastEmittedValue ? static_cast<U>(lastEmittedValue) - static_cast<U>(value)
+                                                    : static_cast<U>(value) - static_cast<U>(lastEmittedValue);
+        return distance < static_cast<U>(deadband);
+    }
+
+    void setDeadband(T delta)
+    {
+        deadband = qMax(T{}, delta);
+    }
+
+    void emitValueChanged()
+    {
+        emitSignalsImpl();
+        lastEmittedValue = value;
+        progressEmitted = interacting;
+    }
+
+    [[nodiscard]] auto changeSourceScope(ValueChangeSource source)
+    {
+        const ValueChangeSource previous = changeSource;
+        changeSource = source;
+        return qScopeGuard([this, previous] {
+            changeSource = previous;
+        });
+    }
+
+    ValueChangeSource buttonChangeSource() const
+    {
+        return (buttonState & Keyboard) ? KeyboardChange : MouseChange;
+    }
+
+    void setEmissionInterval(int msec)
+    {
+        emissionInterval = msec;
+        if (emissionInterval == 0 && emissionTimer.isActive()) {
+            emissionTimer.stop();
+            if (emissionPending) {
+                const auto sourceScope = changeSourceScope(interactionSource);
+                emissionPending = false;
+                emitValueChanged();
             }
         }
     }
@@ -1181,23 +2461,53 @@ private:
     void editorTextChanged(const QString &t)
     {
         Q_Q(QAbstractSpinBox);
+        const auto sourceScope = changeSourceScope(KeyboardChange);
 
-        if (q->keyboardTracking()) {
-            QString tmp = t;
-            int pos = q_edit()->cursorPosition();
-            QValidator::State state = q->validate(tmp, pos);
-            if (state == QValidator::Acceptable) {
-                const auto v = valueFromText(tmp);
-                setValue(v, EmitIfChanged, tmp != t);
-                pendingEmit = false;
-            } else {
-                pendingEmit = true;
-            }
+        if (q->keyboardTracking() && keyboardTrackingDelay > 0) {
+            // Only the text that settles for the delay is interpreted.
+            pendingEmit = true;
+            keyboardTrackingTimer.start(keyboardTrackingDelay * 1ms, q);
+        } else if (q->keyboardTracking()) {
+            trackEditorText(t);
+        } else {
+            pendingEmit = true;
+        }
+    }
+
+    void trackEditorText()
+    {
+        Q_Q(QAbstractSpinBox);
+        const auto sourceScope = changeSourceScope(KeyboardChange);
+        if (pendingEmit && q->keyboardTracking()) {
+            trackEditorText(q_edit()->displayText());
+        }
+    }
+
+    void trackEditorText(const QString &t)
+    {
+        Q_Q(QAbstractSpinBox);
+
+        QString tmp = t;
+        int pos = q_edit()->cursorPosition();
+        QValidator::State state = q->validate(tmp, pos);
+        if (state == QValidator::Acceptable) {
+            const auto v = valueFromText(tmp);
+            setValue(v, EmitIfChanged, tmp != t);
+            pendingEmit = false;
         } else {
             pendingEmit = true;
         }
     }
 
+    void setKeyboardTrackingDelay(int msec)
+    {
+        keyboardTrackingDelay = qMax(0, msec);
+        if (keyboardTrackingDelay == 0 && keyboardTrackingTimer.isActive()) {
+            keyboardTrackingTimer.stop();
+            trackEditorText();
+        }
+    }
+
     void editorCursorPositionChanged(int oldpos, int newpos)
     {
         if (!q_edit()->hasSelectedText() && !ignoreCursorPositionChanged && !specialValue()) {
@@ -1236,6 +2546,33 @@ private:
         }
     }
 
+    // The number in text without affixes, in the display base or the locale.
+    std::optional<T> parseNumber(const QString &copy) const
+    {
+        Q_Q(const QAbstractSpinBox);
+        bool ok = false;
+        T num{};
+        if (displayIntegerBase != 10) {
+            num = stringToInteger<T>(copy, displayIntegerBase, &ok);
+        } else {
+            const auto locale = q->locale();
+            num = localeToValue(locale, copy, &ok);
+            if (!ok && (maximum >= 1000 || minimum <= -1000)) {
+                const QString sep(locale.groupSeparator());
+                const QString doubleSep = sep + sep;
+                if (copy.contains(sep) && !copy.contains(doubleSep)) {
+                    QString copy2 = copy;
+                    copy2.remove(sep);
+                    num = localeToValue(locale, copy2, &ok);
+                }
+            }
+        }
+        if (!ok) {
+            return std::nullopt;
+        }
+        return num;
+    }
+
     T validateAndInterpret(QString &input, int &pos, QValidator::State &state) const
     {
         if (cachedText == input && !input.isEmpty()) {
@@ -1255,48 +2592,22 @@ private:
         if (maximum != minimum && (copy.isEmpty() || (minimum < 0 && copy == "-"_L1) || (maximum >= 0 && copy == "+"_L1))) {
             state = QValidator::Intermediate;
             QSBDEBUG() << __FILE__ << __LINE__ << "num is set to" << num;
+        } else if (decimals > 0 && displayIntegerBase == 10 && copy == q->locale().decimalPoint()) {
+            // A number typed from its decimal point on.
+            state = QValidator::Intermediate;
         } else if (copy.startsWith(u'-') && minimum >= 0) {
             state = QValidator::Invalid; // special-case -0 will be interpreted as 0 and thus not be invalid with a range from 0-100
         } else {
-            bool ok = false;
-            if (displayIntegerBase != 10) {
-                num = copy.toInt(&ok, displayIntegerBase);
-            } else {
-                const auto locale = q->locale();
-                if constexpr (std::is_same_v<T, int>) {
-                    num = locale.toInt(copy, &ok);
-                } else if constexpr (std::is_same_v<T, long>) {
-                    num = locale.toLong(copy, &ok);
-                } else if constexpr (std::is_same_v<T, long long>) {
-                    num = locale.toLongLong(copy, &ok);
-                } else if constexpr (std::is_same_v<T, short>) {
-                    num = locale.toShort(copy, &ok);
-                } else if constexpr (std::is_same_v<T, unsigned int>) {
-                    num = locale.toUInt(copy, &ok);
-                } else if constexpr (std::is_same_v<T, unsigned long>) {
-                    num = locale.toULong(copy, &ok);
-                } else if constexpr (std::is_same_v<T, unsigned long long>) {
-                    num = locale.toULongLong(copy, &ok);
-                } else if constexpr (std::is_same_v<T, unsigned short>) {
-                    num = locale.toUShort(copy, &ok);
-                } else {
-                    static_assert(dependent_false<T>::value, "QExtraSpinBoxPrivate: Unsupported type!");
-                }
-                if (!ok && (maximum >= 1000 || minimum <= -1000)) {
-                    const QString sep(locale.groupSeparator());
-                    const QString doubleSep = sep + sep;
-                    if (copy.contains(sep) && !copy.contains(doubleSep)) {
-                        QString copy2 = copy;
-                        copy2.remove(sep);
-                        num = locale.toInt(copy2, &ok);
-                    }
-                }
-            }
+            const std::optional<T> parsed = parseNumber(copy);
+            num = parsed.value_or(num);
             QSBDEBUG() << __FILE__ << __LINE__ << "num is set to" << num;
-            if (!ok) {
+            if (!parsed) {
                 state = QValidator::Invalid;
-            } else if (num >= minimum && num <= maximum) {
+            } else if (num >= minimum && num <= maximum && isAllowed(num)) {
                 state = QValidator::Acceptable;
+            } else if (num >= minimum && num <= maximum) {
+                // Possibly a prefix of an allowed value.
+                state = QValidator::Intermediate;
             } else if (maximum == minimum) {
                 state = QValidator::Invalid;
             } else {
@@ -1337,8 +2648,12 @@ private:
             QSBDEBUG() << "QExtraSpinBoxPrivate::interpret() text '" << q_edit()->displayText() << "' >> '" << copy << '\'' << "' >> '" << tmp << '\'';
 
             doInterpret = tmp != copy && (q->validate(tmp, pos) == QValidator::Acceptable);
-            if (!doInterpret) {
-                v = (q->correctionMode() == QAbstractSpinBox::CorrectToNearestValue ? qBound(minimum, v, maximum) : value);
+            if (!doInterpret && q->correctionMode() == QAbstractSpinBox::CorrectToNearestValue) {
+                // The typed number brought into range, or the minimum when there is none.
+                const std::optional<T> typed = parseNumber(stripped(tmp));
+                v = nearestAllowed(qBound(minimum, typed.value_or(minimum), maximum));
+            } else if (!doInterpret) {
+                v = value;
             }
         }
         if (doInterpret) {
@@ -1353,26 +2668,57 @@ private:
 
     void updateEditFieldGeometry()
     {
-        Q_Q(QAbstractSpinBox);
-        QStyleOptionSpinBox opt;
-        q_initStyleOption(&opt);
-        opt.subControls = QStyle::SC_SpinBoxEditField;
-        q_edit()->setGeometry(q->style()->subControlRect(QStyle::CC_SpinBox, &opt, QStyle::SC_SpinBoxEditField, q));
+        q_edit()->setGeometry(subControlRect(QStyle::SC_SpinBoxEditField));
     }
 
-    T calculateAdaptiveDecimalStep(int steps) const
+    // base^k for the digit left of the cursor, or for the leading digit when
+    // the cursor is in front of the number. Separators and the sign are skipped.
+    T cursorDigitStep() const
     {
-        const T absValue = qAbs(value);
+        const QString text = q_edit()->displayText();
+        const qsizetype end = text.size() - suffix.size();
+        const qsizetype cursor = qBound<qsizetype>(prefix.size(), q_edit()->cursorPosition(), end);
+
+        int digitsBefore = 0;
+        int digitsAfter = 0;
+        for (qsizetype i = prefix.size(); i < end; ++i) {
+            if (text.at(i).isLetterOrNumber()) {
+                ++(i < cursor ? digitsBefore : digitsAfter);
+            }
+        }
 
-        if (absValue < 100)
-            return 1;
+        const int place = digitsBefore > 0 ? digitsAfter : qMax(0, digitsAfter - 1);
+        T step = 1;
+        for (int k = 0; k < place; ++k) {
+            step = valueMul(step, static_cast<T>(displayIntegerBase));
+        }
+        return step;
+    }
 
+    // The power of ten that changes the adaptiveSignificantDigits leading
+    // digits of the value, and at least 1. Moving towards zero, a value on a
+    // power of ten already takes the smaller step, so 100 steps down by 1.
+    T calculateAdaptiveDecimalStep(qint64 steps) const
+    {
         const bool valueNegative = value < 0;
         const bool stepsNegative = steps < 0;
         const int signCompensation = (valueNegative == stepsNegative) ? 0 : 1;
 
-        const int log = static_cast<T>(std::log10(absValue - signCompensation)) - 1;
-        return static_cast<T>(std::pow(10, log));
+        if constexpr (!std::is_integral_v<T>) {
+            const T absValue = qAbs(value);
+            T step = decadeOf(absValue == 0 ? absValue : absValue - signCompensation);
+            for (int i = 1; i < adaptiveSignificantDigits && step >= 10; ++i) {
+                step /= 10;
+            }
+            return step;
+        } else {
+            // Exact over the whole range, where a double loses precision past 2^53.
+            using U = magnitude_t<T>;
+            const U magnitude = valueNegative ? U(0) - static_cast<U>(value) : static_cast<U>(value);
+            const U reference = magnitude == 0 ? magnitude : magnitude - static_cast<U>(signCompensation);
+            const int exponent = ilog10(reference) + 1 - adaptiveSignificantDigits;
+            return exponent > 0 ? static_cast<T>(pow10<U>(exponent)) : T(1);
+        }
     }
 
     bool updateHoverControl(const QPoint &pos)
@@ -1391,32 +2737,221 @@ private:
 
     QStyle::SubControl newHoverControl(const QPoint &pos)
     {
-        Q_Q(QAbstractSpinBox);
-        QStyleOptionSpinBox opt;
-        q_initStyleOption(&opt);
-        opt.subControls = QStyle::SC_All;
-        hoverControl = q->style()->hitTestComplexControl(QStyle::CC_SpinBox, &opt, pos, q);
-        hoverRect = q->style()->subControlRect(QStyle::CC_SpinBox, &opt, hoverControl, q);
+        // Same hit-testing as QCommonStyle, against the cached rects.
+        const SubControlRects &rects = subControlRects();
+        hoverControl = QStyle::SC_None;
+        hoverRect = QRect();
+        for (const auto &[control, rect] : {std::pair{QStyle::SC_SpinBoxUp, rects.up},
+                                            std::pair{QStyle::SC_SpinBoxDown, rects.down},
+                                            std::pair{QStyle::SC_SpinBoxFrame, rects.frame},
+                                            std::pair{QStyle::SC_SpinBoxEditField, rects.editField}}) {
+            if (rect.isValid() && rect.contains(pos)) {
+                hoverControl = control;
+                hoverRect = rect;
+                break;
+            }
+        }
         return hoverControl;
     }
 
+    void flushWheelSteps()
+    {
+        const auto sourceScope = changeSourceScope(WheelChange);
+        // Faster than this many steps per second, the wheel jumps further than it turned.
+        constexpr qreal velocityThreshold = 20;
+
+        wheelFlushTimer.stop();
+        qint64 steps = pendingWheelSteps;
+        pendingWheelSteps = 0;
+        if (steps == 0) {
+            return;
+        }
+
+        if (wheelClock.isValid() && wheelClock.elapsed() < wheelBurstTimeout) {
+            const qreal velocity = qAbs(steps) * 1000.0 / qMax<qint64>(1, wheelClock.elapsed());
+            if (velocity > velocityThreshold) {
+                steps = static_cast<qint64>(qBound<qreal>(-1e15, steps * velocity / velocityThreshold, 1e15));
+            }
+        }
+        wheelClock.start();
+
+        if (wheelModifiers & stepModifier) {
+            steps = valueMul<qint64>(steps, 10);
+        }
+        if (q_stepEnabled() & (steps > 0 ? QAbstractSpinBox::StepUpEnabled : QAbstractSpinBox::StepDownEnabled)) {
+            beginInteraction();
+            stepBy(steps);
+            if (buttonState == None) {
+                Q_Q(QAbstractSpinBox);
+                wheelIdleTimer.start(wheelBurstTimeout * 1ms, q);
+            }
+        }
+    }
+
+    void startKeyboardRepeat(bool up)
+    {
+        reset(false);
+        buttonState = static_cast<Button>(Keyboard | (up ? Up : Down));
+        if (animateButton) {
+            updateButtonControls();
+        }
+        beginInteraction();
+        startRepeat(true);
+    }
+
+    void startRepeat(bool fromKeyboard)
+    {
+        Q_Q(QAbstractSpinBox);
+        const qreal initialRate = fromKeyboard ? QGuiApplication::styleHints()->keyboardAutoRepeatRateF() : 1000.0 / qMax(1, spinClickTimerInterval);
+        const bool accelerated = q->isAccelerated();
+
+        AccelerationFunction rate = [initialRate](std::chrono::milliseconds) {
+            return initialRate;
+        };
+        if (accelerated) {
+            rate = accelerationRate(initialRate);
+        }
+
+        // The key repeat delay has already passed when the first auto-repeat event arrives,
+        // and a held key is stepped at most once per frame.
+        const std::chrono::milliseconds threshold = fromKeyboard ? 0ms : spinClickThresholdTimerInterval * 1ms;
+        const std::chrono::milliseconds minimumInterval = fromKeyboard ? frameInterval() : 10ms;
+        QExtraSpinBoxRepeatDriver::start(this, threshold, minimumInterval, true, rate, [this](qint64 steps) {
+            return repeatStep(steps);
+        });
+    }
+
+    AccelerationFunction accelerationRate(qreal initialRate) const
+    {
+        // Beyond 100 steps/s the driver's 10 ms floor is reached and each tick
+        // steps several times, so the step size keeps growing with the rate,
+        // up to the driver's limit of 1e18 steps per tick.
+        switch (accelerationCurve) {
+        case ExponentialAcceleration:
+            // Doubles every half second.
+            return [initialRate](std::chrono::milliseconds held) {
+                return initialRate * std::exp2(held.count() / 500.0);
+            };
+        case EaseInAcceleration:
+            return [initialRate](std::chrono::milliseconds held) {
+                const qreal seconds = held.count() / 1000.0;
+                return initialRate + 100 * seconds * seconds * seconds;
+            };
+        case CustomAcceleration:
+            if (accelerationFunction) {
+                return accelerationFunction;
+            }
+            Q_FALLTHROUGH();
+        case LinearAcceleration:
+        default:
+            // Grows linearly, reaching ten times the initial rate after one second.
+            return [initialRate](std::chrono::milliseconds held) {
+                return initialRate * (1 + 9 * held.count() / 1000.0);
+            };
+        }
+    }
+
+    qint64 repeatStep(qint64 steps)
+    {
+        Q_Q(QAbstractSpinBox);
+        const auto sourceScope = changeSourceScope(buttonChangeSource());
+        if (!(buttonState & (Up | Down))) {
+            return 0;
+        }
+
+        const bool up = buttonState & Up;
+        const auto st = q_stepEnabled();
+        if (!(st & (up ? QAbstractSpinBox::StepUpEnabled : QAbstractSpinBox::StepDownEnabled))) {
+            reset();
+            return 0;
+        }
+
+        // Always through the virtual QAbstractSpinBox::stepBy(int) so that subclasses see
+        // every tick. A tick of more than INT_MAX steps passes each step of stepBy() as
+        // repeatScale single steps instead, leaving less than one scaled step to the next tick.
+        const quint64 factor = (keyboardModifiers & stepModifier) ? 10 : 1;
+        const quint64 total = static_cast<quint64>(steps) * factor;
+        const quint64 scale = total <= quint64(std::numeric_limits<int>::max()) ? 1 : total / std::numeric_limits<int>::max() + 1;
+        const int count = static_cast<int>(total / scale);
+        repeatScale = scale;
+        const auto scaleGuard = qScopeGuard([this] {
+            repeatScale = 1;
+        });
+        q->stepBy(up ? count : -count);
+        return static_cast<qint64>((total - quint64(count) * scale) / factor);
+    }
+
+    void startScrub()
+    {
+        // At most one step per frame, however fast the rate.
+        scrubbing = true;
+        QExtraSpinBoxRepeatDriver::start(
+            this,
+            0ms,
+            frameInterval(),
+            false,
+            [this](std::chrono::milliseconds) {
+                return scrubRate();
+            },
+            [this](qint64 steps) {
+                scrubStep(steps);
+                return qint64(0);
+            });
+    }
+
+    qreal scrubRate() const
+    {
+        // Dragging within the start drag distance leaves the value alone.
+        const int distance = qMax(0, qAbs(scrubDistance) - QGuiApplication::styleHints()->startDragDistance());
+        switch (scrubCurve) {
+        case LinearAcceleration:
+            return 10.0 * distance;
+        case EaseInAcceleration:
+            return 0.01 * distance * distance * distance;
+        case CustomAcceleration:
+            if (scrubFunction) {
+                return scrubFunction(distance);
+            }
+            Q_FALLTHROUGH();
+        case ExponentialAcceleration:
+        default:
+            // Doubles every 10 pixels, a few hundred pixels cover a 64-bit range.
+            return distance > 0 ? std::exp2(distance / 10.0) : 0;
+        }
+    }
+
+    void scrubStep(qint64 steps)
+    {
+        const auto sourceScope = changeSourceScope(MouseChange);
+        const bool up = scrubDistance < 0;
+        if (q_stepEnabled() & (up ? QAbstractSpinBox::StepUpEnabled : QAbstractSpinBox::StepDownEnabled)) {
+            stepBy(up ? steps : -steps);
+        }
+    }
+
     void updateState(bool up, bool fromKeyboard = false)
     {
         Q_Q(QAbstractSpinBox);
+        const auto sourceScope = changeSourceScope(fromKeyboard ? KeyboardChange : MouseChange);
         if ((up && (buttonState & Up)) || (!up && (buttonState & Down)))
             return;
-        reset();
+        // Switching direction mid-burst continues the same interaction.
+        reset(false);
         if (q && (q_stepEnabled() & (up ? QAbstractSpinBox::StepUpEnabled : QAbstractSpinBox::StepDownEnabled))) {
             buttonState = static_cast<Button>((up ? Up : Down) | (fromKeyboard ? Keyboard : Mouse));
+            updateButtonControls();
+            beginInteraction();
             int steps = up ? 1 : -1;
             if (keyboardModifiers & stepModifier)
                 steps *= 10;
             q->stepBy(steps);
-            spinClickThresholdTimer.start(spinClickThresholdTimerInterval * 1ms, q);
+            startRepeat(fromKeyboard);
 #if QT_CONFIG(accessibility)
-            QAccessibleValueChangeEvent event(q, value);
+            QAccessibleValueChangeEvent event(q, accessibleValue());
             QAccessible::updateAccessibility(&event);
 #endif
+        } else {
+            finishInteraction();
         }
     }
 };
@@ -0,0 +1,308 @@
+// SPDX-FileCopyrightText: 2025 Trần Nam Tuấn <tuantran1632001@gmail.com>
+// SPDX-License-Identifier: GPL-3.0-only
+
+#ifndef QTEXTRASPINBOXES_ARITHMETIC_P_H
+#define QTEXTRASPINBOXES_ARITHMETIC_P_H
+
+// Integer arithmetic of the spin boxes. Kept free of Qt, so the checks at the
+// bottom can be compiled on their own.
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if !defined(QTEXTRASPINBOXES_NO_OVERFLOW_BUILTINS) && (defined(__GNUC__) || defined(__clang__))
+#define QTEXTRASPINBOXES_OVERFLOW_BUILTINS
+#endif
+
+namespace QtExtraSpinBoxes
+{
+// Checked arithmetic. Stores the result wrapped modulo 2^N in *r and returns
+// whether it overflowed. The builtins compile to the operation and a flag test.
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+constexpr static bool checkedAdd(T a, T b, T *r) noexcept
+{
+#ifdef QTEXTRASPINBOXES_OVERFLOW_BUILTINS
+    return __builtin_add_overflow(a, b, r);
+#else
+    using U = std::make_unsigned_t<T>;
+    *r = static_cast<T>(static_cast<U>(static_cast<U>(a) + static_cast<U>(b)));
+    if constexpr (std::is_signed_v<T>) {
+        // Overflow iff both operands have the sign the result lacks.
+        return ((a ^ *r) & (b ^ *r)) < 0;
+    } else {
+        return *r < a;
+    }
+#endif
+}
+
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+constexpr static bool checkedSub(T a, T b, T *r) noexcept
+{
+#ifdef QTEXTRASPINBOXES_OVERFLOW_BUILTINS
+    return __builtin_sub_overflow(a, b, r);
+#else
+    using U = std::make_unsigned_t<T>;
+    *r = static_cast<T>(static_cast<U>(static_cast<U>(a) - static_cast<U>(b)));
+    if constexpr (std::is_signed_v<T>) {
+        // Overflow iff the operands differ in sign and the result has the sign of b.
+        return ((a ^ b) & (a ^ *r)) < 0;
+    } else {
+        return a < b;
+    }
+#endif
+}
+
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+constexpr static bool checkedMul(T a, T b, T *r) noexcept
+{
+#ifdef QTEXTRASPINBOXES_OVERFLOW_BUILTINS
+    return __builtin_mul_overflow(a, b, r);
+#else
+    static_assert(sizeof(T) >= sizeof(int), "checkedMul: Narrow types promote to int");
+    using U = std::make_unsigned_t<T>;
+    *r = static_cast<T>(static_cast<U>(static_cast<U>(a) * static_cast<U>(b)));
+    if constexpr (std::is_signed_v<T>) {
+        const bool negative = (a < 0) != (b < 0);
+        const U ma = a < 0 ? U(0) - static_cast<U>(a) : static_cast<U>(a);
+        const U mb = b < 0 ? U(0) - static_cast<U>(b) : static_cast<U>(b);
+        const U limit = negative ? U(0) - static_cast<U>(std::numeric_limits<T>::min()) : static_cast<U>(std::numeric_limits<T>::max());
+        return ma != 0 && mb > limit / ma;
+    } else {
+        return a != 0 && b > std::numeric_limits<T>::max() / a;
+    }
+#endif
+}
+
+// Saturating arithmetic, the result clamps to the limits of T.
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+constexpr static T valueAdd(T a, T b) noexcept
+{
+    T r{};
+    if (!checkedAdd(a, b, &r)) {
+        return r;
+    }
+    if constexpr (std::is_signed_v<T>) {
+        return b < 0 ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+    } else {
+        return std::numeric_limits<T>::max();
+    }
+}
+
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+constexpr static T valueSub(T a, T b) noexcept
+{
+    T r{};
+    if (!checkedSub(a, b, &r)) {
+        return r;
+    }
+    if constexpr (std::is_signed_v<T>) {
+        return b < 0 ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+    } else {
+        return 0;
+    }
+}
+
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+constexpr static T valueMul(T a, T b) noexcept
+{
+    T r{};
+    if (!checkedMul(a, b, &r)) {
+        return r;
+    }
+    if constexpr (std::is_signed_v<T>) {
+        return (a < 0) != (b < 0) ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+    } else {
+        return std::numeric_limits<T>::max();
+    }
+}
+
+// v moved count steps of step up or down. Returns whether that overflowed T,
+// with the result wrapped modulo 2^N in *r. Works on the unsigned distance
+// |step| * count, so counts past the limit of T are exact too.
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+constexpr static bool checkedStep(T v, T step, std::make_unsigned_t<T> count, bool up, T *r) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+    bool down = !up;
+    U magnitude = static_cast<U>(step);
+    if constexpr (std::is_signed_v<T>) {
+        if (step < 0) {
+            down = up;
+            magnitude = U(0) - magnitude;
+        }
+    }
+
+    U distance{};
+    bool overflow = checkedMul(magnitude, count, &distance);
+#ifdef QTEXTRASPINBOXES_OVERFLOW_BUILTINS
+    // The builtins take mixed types and check the exact result against T.
+    overflow |= down ? __builtin_sub_overflow(v, distance, r) : __builtin_add_overflow(v, distance, r);
+#else
+    const U room = down ? static_cast<U>(v) - static_cast<U>(std::numeric_limits<T>::min()) : static_cast<U>(std::numeric_limits<T>::max()) - static_cast<U>(v);
+    overflow |= distance > room;
+    *r = static_cast<T>(down ? static_cast<U>(v) - distance : static_cast<U>(v) + distance);
+#endif
+    return overflow;
+}
+
+// The limit an overflowing checkedStep() saturates at.
+template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+constexpr static T stepLimit(T step, bool up) noexcept
+{
+    return (step > 0) == up ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+}
+
+// The number of bits needed for v, 0 for 0.
+template<typename U, std::enable_if_t<std::is_integral_v<U> && std::is_unsigned_v<U>, bool> = true>
+constexpr static int bitWidth(U v) noexcept
+{
+    if constexpr (std::numeric_limits<U>::digits > 64) {
+        const std::uint64_t high = static_cast<std::uint64_t>(v >> 64);
+        return high != 0 ? 64 + bitWidth(high) : bitWidth(static_cast<std::uint64_t>(v));
+    } else {
+#ifdef QTEXTRASPINBOXES_OVERFLOW_BUILTINS
+        return v == 0 ? 0 : 64 - __builtin_clzll(static_cast<unsigned long long>(v));
+#else
+        int width = 0;
+        for (std::uint64_t x = v; x != 0; x >>= 1) {
+            ++width;
+        }
+        return width;
+#endif
+    }
+}
+
+// 10^0 up to the largest power of ten in U.
+template<typename U>
+struct PowersOf10 {
+    static constexpr int count = std::numeric_limits<U>::digits10 + 1;
+    U values[count] = {};
+
+    constexpr PowersOf10() noexcept
+    {
+        U p = 1;
+        for (int i = 0; i < count; ++i) {
+            values[i] = p;
+            p *= 10;
+        }
+    }
+};
+
+template<typename U>
+inline constexpr PowersOf10<U> powersOf10{};
+
+// 10^exponent, exponent must be within 0 and digits10 of U.
+template<typename U, std::enable_if_t<std::is_integral_v<U> && std::is_unsigned_v<U>, bool> = true>
+constexpr static U pow10(int exponent) noexcept
+{
+    return powersOf10<U>.values[exponent];
+}
+
+// floor(log10(v)), 0 for 0. The bit width gives the digit count up to one,
+// log10(2) being about 1233 / 4096, and one table lookup settles it.
+template<typename U, std::enable_if_t<std::is_integral_v<U> && std::is_unsigned_v<U>, bool> = true>
+constexpr static int ilog10(U v) noexcept
+{
+    const int guess = (bitWidth(v) * 1233) >> 12;
+    return guess - (v < pow10<U>(guess) ? 1 : 0) + (v == 0 ? 1 : 0);
+}
+
+// The largest power of ten not above magnitude, or 1 for 0.
+template<typename U, std::enable_if_t<std::is_integral_v<U> && std::is_unsigned_v<U>, bool> = true>
+constexpr static U decadeOf(U magnitude) noexcept
+{
+    return pow10<U>(ilog10(magnitude));
+}
+
+// Checks at the limits of every value type of the spin boxes.
+namespace ArithmeticChecks
+{
+template<typename T>
+constexpr T add(T a, T b, bool overflow)
+{
+    T r{};
+    return checkedAdd(a, b, &r) == overflow ? r : T(42);
+}
+
+template<typename T>
+constexpr T sub(T a, T b, bool overflow)
+{
+    T r{};
+    return checkedSub(a, b, &r) == overflow ? r : T(42);
+}
+
+template<typename T>
+constexpr T mul(T a, T b, bool overflow)
+{
+    T r{};
+    return checkedMul(a, b, &r) == overflow ? r : T(42);
+}
+
+template<typename T>
+constexpr T step(T v, T step, std::make_unsigned_t<T> count, bool up, bool overflow)
+{
+    T r{};
+    return checkedStep(v, step, count, up, &r) == overflow ? r : T(42);
+}
+
+template<typename T>
+constexpr bool check()
+{
+    using L = std::numeric_limits<T>;
+    using U = std::make_unsigned_t<T>;
+    constexpr T max = L::max();
+    constexpr T min = L::min();
+    constexpr T half = max / 2 + 1;
+
+    static_assert(add<T>(max, 0, false) == max && add<T>(max, 1, true) == min && add<T>(max - 1, 1, false) == max);
+    static_assert(add<T>(half, half - 1, false) == max && add<T>(half, half, true) == T(U(half) * 2));
+    static_assert(sub<T>(min, 0, false) == min && sub<T>(min, 1, true) == max && sub<T>(min + 1, 1, false) == min);
+    static_assert(mul<T>(max, 1, false) == max && mul<T>(max, 0, false) == 0 && mul<T>(half, 2, true) == T(U(half) * 2));
+    static_assert(valueAdd<T>(max, 1) == max && valueAdd<T>(max, max) == max && valueAdd<T>(min, 0) == min);
+    static_assert(valueSub<T>(min, 1) == min && valueSub<T>(max, max) == 0 && valueSub<T>(min, max) == min);
+    static_assert(valueMul<T>(max, 2) == max && valueMul<T>(half, 2) == max && valueMul<T>(max, 1) == max);
+    static_assert(step<T>(max, 1, 1, true, true) == min && step<T>(min, 1, 1, false, true) == max && step<T>(0, 0, U(-1), true, false) == 0);
+    static_assert(step<T>(max - 2, 1, 2, true, false) == max && step<T>(min, 2, 3, true, false) == T(min + 6));
+    static_assert(stepLimit<T>(1, true) == max && stepLimit<T>(1, false) == min);
+    static_assert(ilog10<U>(0) == 0 && ilog10<U>(1) == 0 && ilog10<U>(9) == 0 && ilog10<U>(10) == 1 && ilog10<U>(99) == 1 && ilog10<U>(100) == 2);
+    static_assert(ilog10<U>(U(-1)) == std::numeric_limits<U>::digits10 && ilog10<U>(U(max)) == L::digits10);
+    static_assert(ilog10<U>(pow10<U>(std::numeric_limits<U>::digits10)) == std::numeric_limits<U>::digits10);
+    static_assert(ilog10<U>(pow10<U>(std::numeric_limits<U>::digits10) - 1) == std::numeric_limits<U>::digits10 - 1);
+    static_assert(decadeOf<U>(0) == 1 && decadeOf<U>(120) == 100 && decadeOf<U>(U(-1)) == pow10<U>(std::numeric_limits<U>::digits10));
+    if constexpr (std::is_signed_v<T>) {
+        static_assert(add<T>(min, -1, true) == max && add<T>(min, max, false) == -1 && add<T>(-1, min + 1, false) == min);
+        static_assert(sub<T>(max, -1, true) == min && sub<T>(0, min, true) == min && sub<T>(-1, max, false) == min);
+        static_assert(mul<T>(min, -1, true) == min && mul<T>(max, -1, false) == min + 1 && mul<T>(-half, 2, false) == min);
+        static_assert(mul<T>(min, 1, false) == min && mul<T>(-1, -1, false) == 1 && mul<T>(half, -2, false) == min);
+        static_assert(valueAdd<T>(min, -1) == min && valueSub<T>(max, -1) == max && valueSub<T>(0, min) == max);
+        static_assert(valueMul<T>(min, -1) == max && valueMul<T>(max, -2) == min && valueMul<T>(min, 2) == min);
+        static_assert(step<T>(0, -1, U(max) + 1, true, false) == min && step<T>(0, 1, U(max) + 1, true, true) == min);
+        static_assert(step<T>(0, -1, U(max) + 1, false, true) == min && stepLimit<T>(-1, true) == min && stepLimit<T>(-1, false) == max);
+    } else {
+        static_assert(sub<T>(0, max, true) == 1 && mul<T>(max, max, true) == 1 && step<T>(0, 1, max, false, true) == 1);
+    }
+    return true;
+}
+
+// Strict ISO modes do not count the 128-bit types as integral.
+template<typename T>
+constexpr bool checkIfIntegral()
+{
+    if constexpr (std::is_integral_v<T>) {
+        return check<T>();
+    } else {
+        return true;
+    }
+}
+
+static_assert(check<std::int32_t>() && check<std::uint32_t>() && check<std::int64_t>() && check<std::uint64_t>());
+#ifdef __SIZEOF_INT128__
+__extension__ typedef __int128 Int128;
+__extension__ typedef unsigned __int128 UInt128;
+static_assert(checkIfIntegral<Int128>() && checkIfIntegral<UInt128>());
+#endif
+} // namespace ArithmeticChecks
+} // namespace QtExtraSpinBoxes
+
+#endif // QTEXTRASPINBOXES_ARITHMETIC_P_H
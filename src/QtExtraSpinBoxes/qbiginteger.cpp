@@ -0,0 +1,655 @@
+// SPDX-FileCopyrightText: 2025 Trần Nam Tuấn <tuantran1632001@gmail.com>
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include "QtExtraSpinBoxes/qbiginteger.hpp"
+
+#include <QList>
+
+#include <cmath>
+
+namespace QtExtraSpinBoxes
+{
+namespace
+{
+using Limb = quint32;
+using Limbs = QVarLengthArray<Limb, 4>;
+
+constexpr int limbBits = std::numeric_limits<Limb>::digits;
+
+// Below this many limbs schoolbook multiplication beats Karatsuba.
+constexpr qsizetype karatsubaThreshold = 32;
+
+// Below this many divisor limbs Knuth's division beats a Newton reciprocal.
+constexpr qsizetype newtonThreshold = 64;
+
+qsizetype trimmedSize(const Limb *a, qsizetype n) noexcept
+{
+    while (n > 0 && a[n - 1] == 0) {
+        --n;
+    }
+    return n;
+}
+
+void trim(Limbs &a) noexcept
+{
+    a.resize(trimmedSize(a.data(), a.size()));
+}
+
+int compareMagnitude(const Limb *a, qsizetype an, const Limb *b, qsizetype bn) noexcept
+{
+    an = trimmedSize(a, an);
+    bn = trimmedSize(b, bn);
+    if (an != bn) {
+        return an < bn ? -1 : 1;
+    }
+    for (qsizetype i = an - 1; i >= 0; --i) {
+        if (a[i] != b[i]) {
+            return a[i] < b[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+Limbs addMagnitude(const Limb *a, qsizetype an, const Limb *b, qsizetype bn)
+{
+    if (an < bn) {
+        std::swap(a, b);
+        std::swap(an, bn);
+    }
+    Limbs r(an + 1);
+    quint64 carry = 0;
+    for (qsizetype i = 0; i < an; ++i) {
+        carry += quint64(a[i]) + (i < bn ? b[i] : 0);
+        r[i] = static_cast<Limb>(carry);
+        carry >>= limbBits;
+    }
+    r[an] = static_cast<Limb>(carry);
+    trim(r);
+    return r;
+}
+
+// Requires a >= b.
+Limbs subMagnitude(const Limb *a, qsizetype an, const Limb *b, qsizetype bn)
+{
+    Limbs r(an);
+    qint64 borrow = 0;
+    for (qsizetype i = 0; i < an; ++i) {
+        qint64 t = qint64(a[i]) - (i < bn ? b[i] : 0) - borrow;
+        borrow = t < 0 ? 1 : 0;
+        r[i] = static_cast<Limb>(t + (borrow << limbBits));
+    }
+    trim(r);
+    return r;
+}
+
+// r += x * 2^(32 * shift), r must be large enough.
+void addShifted(Limbs &r, const Limbs &x, qsizetype shift)
+{
+    quint64 carry = 0;
+    qsizetype i = 0;
+    for (; i < x.size(); ++i) {
+        carry += quint64(r[i + shift]) + x[i];
+        r[i + shift] = static_cast<Limb>(carry);
+        carry >>= limbBits;
+    }
+    for (; carry != 0; ++i) {
+        carry += r[i + shift];
+        r[i + shift] = static_cast<Limb>(carry);
+        carry >>= limbBits;
+    }
+}
+
+Limbs mulMagnitude(const Limb *a, qsizetype an, const Limb *b, qsizetype bn)
+{
+    an = trimmedSize(a, an);
+    bn = trimmedSize(b, bn);
+    if (an == 0 || bn == 0) {
+        return {};
+    }
+
+    if (an < bn) {
+        std::swap(a, b);
+        std::swap(an, bn);
+    }
+    if (bn >= karatsubaThreshold && bn <= an / 2) {
+        // Unbalanced: Karatsuba on slices of a as long as b.
+        Limbs r(an + bn + 1);
+        std::fill(r.begin(), r.end(), 0);
+        for (qsizetype i = 0; i < an; i += bn) {
+            addShifted(r, mulMagnitude(a + i, qMin(bn, an - i), b, bn), i);
+        }
+        trim(r);
+        return r;
+    }
+
+    const qsizetype half = an / 2;
+    if (bn < karatsubaThreshold || bn <= half) {
+        Limbs r(an + bn);
+        std::fill(r.begin(), r.end(), 0);
+        for (qsizetype i = 0; i < an; ++i) {
+            quint64 carry = 0;
+            for (qsizetype j = 0; j < bn; ++j) {
+                carry += quint64(a[i]) * b[j] + r[i + j];
+                r[i + j] = static_cast<Limb>(carry);
+                carry >>= limbBits;
+            }
+            r[i + bn] = static_cast<Limb>(carry);
+        }
+        trim(r);
+        return r;
+    }
+
+    // Karatsuba: (a1 x + a0)(b1 x + b0) with x = 2^(32 * half) needs three
+    // products, a0 b0, a1 b1 and (a0 + a1)(b0 + b1).
+    const Limbs z0 = mulMagnitude(a, half, b, half);
+    const Limbs z2 = mulMagnitude(a + half, an - half, b + half, bn - half);
+    const Limbs aSum = addMagnitude(a, half, a + half, an - half);
+    const Limbs bSum = addMagnitude(b, half, b + half, bn - half);
+    Limbs z1 = mulMagnitude(aSum.data(), aSum.size(), bSum.data(), bSum.size());
+    z1 = subMagnitude(z1.data(), z1.size(), z0.data(), z0.size());
+    z1 = subMagnitude(z1.data(), z1.size(), z2.data(), z2.size());
+
+    Limbs r(an + bn + 1);
+    std::fill(r.begin(), r.end(), 0);
+    addShifted(r, z0, 0);
+    addShifted(r, z1, half);
+    addShifted(r, z2, 2 * half);
+    trim(r);
+    return r;
+}
+
+Limbs mulMagnitude(const Limbs &a, const Limbs &b)
+{
+    return mulMagnitude(a.data(), a.size(), b.data(), b.size());
+}
+
+Limbs addMagnitude(const Limbs &a, const Limbs &b)
+{
+    return addMagnitude(a.data(), a.size(), b.data(), b.size());
+}
+
+Limbs subMagnitude(const Limbs &a, const Limbs &b)
+{
+    return subMagnitude(a.data(), a.size(), b.data(), b.size());
+}
+
+int compareMagnitude(const Limbs &a, const Limbs &b) noexcept
+{
+    return compareMagnitude(a.data(), a.size(), b.data(), b.size());
+}
+
+// 2^(32 * exponent).
+Limbs limbPower(qsizetype exponent)
+{
+    Limbs r(exponent + 1);
+    std::fill(r.begin(), r.end(), 0);
+    r[exponent] = 1;
+    return r;
+}
+
+// a * 2^(32 * shift).
+Limbs shiftedUp(const Limbs &a, qsizetype shift)
+{
+    if (a.isEmpty()) {
+        return {};
+    }
+    Limbs r(a.size() + shift);
+    std::fill(r.begin(), r.begin() + shift, 0);
+    std::copy(a.begin(), a.end(), r.begin() + shift);
+    return r;
+}
+
+// a / 2^(32 * shift).
+Limbs shiftedDown(const Limbs &a, qsizetype shift)
+{
+    if (a.size() <= shift) {
+        return {};
+    }
+    return Limbs(a.begin() + shift, a.end());
+}
+
+// Divides a in place and returns the remainder.
+Limb divModSmall(Limbs &a, Limb d) noexcept
+{
+    quint64 remainder = 0;
+    for (qsizetype i = a.size() - 1; i >= 0; --i) {
+        const quint64 t = (remainder << limbBits) | a[i];
+        a[i] = static_cast<Limb>(t / d);
+        remainder = t % d;
+    }
+    trim(a);
+    return static_cast<Limb>(remainder);
+}
+
+// Knuth's algorithm D. b must not be zero.
+void divModMagnitude(const Limbs &a, const Limbs &b, Limbs *q, Limbs *r)
+{
+    const qsizetype m = a.size();
+    const qsizetype n = b.size();
+    if (compareMagnitude(a.data(), m, b.data(), n) < 0) {
+        *q = {};
+        *r = a;
+        return;
+    }
+    if (n == 1) {
+        *q = a;
+        const Limb remainder = divModSmall(*q, b[0]);
+        *r = {};
+        if (remainder != 0) {
+            r->append(remainder);
+        }
+        return;
+    }
+
+    // Normalize so the top limb of the divisor has its high bit set.
+    const int s = qCountLeadingZeroBits(b[n - 1]);
+    Limbs vn(n);
+    for (qsizetype i = n - 1; i > 0; --i) {
+        vn[i] = static_cast<Limb>(((quint64(b[i]) << limbBits | b[i - 1]) << s) >> limbBits);
+    }
+    vn[0] = static_cast<Limb>(quint64(b[0]) << s);
+    Limbs un(m + 1);
+    un[m] = static_cast<Limb>((quint64(a[m - 1]) << s) >> limbBits);
+    for (qsizetype i = m - 1; i > 0; --i) {
+        un[i] = static_cast<Limb>(((quint64(a[i]) << limbBits | a[i - 1]) << s) >> limbBits);
+    }
+    un[0] = static_cast<Limb>(quint64(a[0]) << s);
+
+    constexpr quint64 base = quint64(1) << limbBits;
+    q->resize(m - n + 1);
+    for (qsizetype j = m - n; j >= 0; --j) {
+        const quint64 numerator = quint64(un[j + n]) << limbBits | un[j + n - 1];
+        quint64 qhat = numerator / vn[n - 1];
+        quint64 rhat = numerator % vn[n - 1];
+        while (qhat >= base || qhat * vn[n - 2] > (rhat << limbBits | un[j + n - 2])) {
+            --qhat;
+            rhat += vn[n - 1];
+            if (rhat >= base) {
+                break;
+            }
+        }
+
+        qint64 borrow = 0;
+        for (qsizetype i = 0; i < n; ++i) {
+            const quint64 p = qhat * vn[i];
+            const qint64 t = qint64(un[i + j]) - borrow - qint64(p & (base - 1));
+            un[i + j] = static_cast<Limb>(t);
+            borrow = qint64(p >> limbBits) - (t >> limbBits);
+        }
+        const qint64 t = qint64(un[j + n]) - borrow;
+        un[j + n] = static_cast<Limb>(t);
+
+        (*q)[j] = static_cast<Limb>(qhat);
+        if (t < 0) {
+            // qhat was one too large, add the divisor back.
+            (*q)[j] -= 1;
+            quint64 carry = 0;
+            for (qsizetype i = 0; i < n; ++i) {
+                carry += quint64(un[i + j]) + vn[i];
+                un[i + j] = static_cast<Limb>(carry);
+                carry >>= limbBits;
+            }
+            un[j + n] += static_cast<Limb>(carry);
+        }
+    }
+    trim(*q);
+
+    r->resize(n);
+    for (qsizetype i = 0; i < n; ++i) {
+        (*r)[i] = static_cast<Limb>((quint64(un[i + 1]) << limbBits | un[i]) >> s);
+    }
+    trim(*r);
+}
+
+// floor(2^(64 n) / d) for the n limbs of d. The reciprocal of the top limbs
+// of d, one Newton step and a few unit corrections cost a constant number of
+// n limb multiplications, so this is O(M(n)) instead of O(n^2).
+Limbs reciprocal(const Limbs &d)
+{
+    const qsizetype n = d.size();
+    const Limbs one = limbPower(2 * n);
+    if (n <= newtonThreshold) {
+        Limbs q;
+        Limbs r;
+        divModMagnitude(one, d, &q, &r);
+        return q;
+    }
+
+    // y = floor(2^(64 h) / top h limbs of d) approximates 2^(64 n) / d as
+    // y 2^(32 (n - h)), with a relative error below 2^(33 - 32 h). One Newton
+    // step, x = y' + y' (2^(64 n) - d y') / 2^(64 n) for y' = y 2^(32 (n - h)),
+    // squares it, which leaves a few units for h a little over n / 2.
+    const qsizetype h = n / 2 + 2;
+    const Limbs y = reciprocal(shiftedDown(d, n - h));
+    const Limbs scaledOne = limbPower(n + h);
+    const Limbs dy = mulMagnitude(d, y);
+    Limbs x = shiftedUp(y, n - h);
+    if (compareMagnitude(dy, scaledOne) <= 0) {
+        x = addMagnitude(x, shiftedDown(mulMagnitude(y, subMagnitude(scaledOne, dy)), 2 * h));
+    } else {
+        x = subMagnitude(x, shiftedDown(mulMagnitude(y, subMagnitude(dy, scaledOne)), 2 * h));
+    }
+
+    // A broken Newton step or product would otherwise only show as a very long loop.
+    const Limbs unit{1};
+    int corrections = 0;
+    Limbs dx = mulMagnitude(d, x);
+    while (compareMagnitude(dx, one) > 0) {
+        x = subMagnitude(x, unit);
+        dx = subMagnitude(dx, d);
+        Q_ASSERT_X(++corrections <= 4, "reciprocal", "inexact Newton step");
+    }
+    Limbs r = subMagnitude(one, dx);
+    while (compareMagnitude(r, d) >= 0) {
+        x = addMagnitude(x, unit);
+        r = subMagnitude(r, d);
+        Q_ASSERT_X(++corrections <= 4, "reciprocal", "inexact Newton step");
+    }
+    Q_UNUSED(corrections);
+    return x;
+}
+
+// Barrett's division by d with mu = reciprocal(d), for a below 2^(64 n). The
+// estimated quotient is at most 2 too small, so two multiplications and a
+// few subtractions replace Knuth's O(n^2) loop.
+void divModBarrett(const Limbs &a, const Limbs &d, const Limbs &mu, Limbs *q, Limbs *r)
+{
+    const qsizetype n = d.size();
+    *q = shiftedDown(mulMagnitude(shiftedDown(a, n - 1), mu), n + 1);
+    *r = subMagnitude(a, mulMagnitude(*q, d));
+    // More corrections mean mu is not the exact reciprocal, which would only cost time.
+    const Limbs unit{1};
+    int corrections = 0;
+    while (compareMagnitude(*r, d) >= 0) {
+        *r = subMagnitude(*r, d);
+        *q = addMagnitude(*q, unit);
+        Q_ASSERT_X(++corrections <= 2, "divModBarrett", "inexact reciprocal");
+    }
+    Q_UNUSED(corrections);
+}
+
+// The digits of one limb sized chunk, and base^chunkDigits.
+struct Radix {
+    int chunkDigits = 0;
+    Limb chunk = 1;
+
+    explicit Radix(int base)
+    {
+        while (quint64(chunk) * base <= std::numeric_limits<Limb>::max()) {
+            chunk *= base;
+            ++chunkDigits;
+        }
+    }
+};
+
+// powers[k] = chunk^(2^k), grown on demand.
+void ensurePowers(QList<Limbs> &powers, Limb chunk, qsizetype count)
+{
+    if (powers.isEmpty()) {
+        powers.append(Limbs{chunk});
+    }
+    while (powers.size() < count) {
+        powers.append(mulMagnitude(powers.last(), powers.last()));
+    }
+}
+
+// Divide and conquer: n < powers[level + 1] splits into two halves below powers[level].
+// With the reciprocals of the large powers every level costs O(M(n)), so the
+// whole conversion is O(M(n) log n).
+void appendDigits(QString &out,
+                  const Limbs &n,
+                  const QList<Limbs> &powers,
+                  const QList<Limbs> &reciprocals,
+                  qsizetype level,
+                  bool pad,
+                  int base,
+                  int chunkDigits)
+{
+    if (level < 0) {
+        const QString digits = QString::number(n.isEmpty() ? 0 : n[0], base);
+        if (pad) {
+            out.append(QString(chunkDigits - digits.size(), u'0'));
+        }
+        out.append(digits);
+        return;
+    }
+
+    Limbs q;
+    Limbs r;
+    if (reciprocals[level].isEmpty()) {
+        divModMagnitude(n, powers[level], &q, &r);
+    } else {
+        divModBarrett(n, powers[level], reciprocals[level], &q, &r);
+    }
+    if (!pad && q.isEmpty()) {
+        appendDigits(out, r, powers, reciprocals, level - 1, false, base, chunkDigits);
+        return;
+    }
+    appendDigits(out, q, powers, reciprocals, level - 1, pad, base, chunkDigits);
+    appendDigits(out, r, powers, reciprocals, level - 1, true, base, chunkDigits);
+}
+
+// Divide and conquer: high chunks * powers[k] + the 2^k low chunks.
+Limbs combineChunks(const QList<Limb> &chunks, qsizetype begin, qsizetype end, QList<Limbs> &powers, Limb chunk)
+{
+    const qsizetype count = end - begin;
+    if (count == 1) {
+        Limbs r{chunks[begin]};
+        trim(r);
+        return r;
+    }
+
+    int k = 0;
+    while ((qsizetype(2) << k) < count) {
+        ++k;
+    }
+    const qsizetype lowCount = qsizetype(1) << k;
+    ensurePowers(powers, chunk, k + 1);
+    const Limbs high = combineChunks(chunks, begin, end - lowCount, powers, chunk);
+    const Limbs low = combineChunks(chunks, end - lowCount, end, powers, chunk);
+    const Limbs shifted = mulMagnitude(high, powers[k]);
+    return addMagnitude(shifted.data(), shifted.size(), low.data(), low.size());
+}
+
+int digitValue(QChar c) noexcept
+{
+    const char16_t u = c.unicode();
+    if (u >= u'0' && u <= u'9') {
+        return u - u'0';
+    }
+    if (u >= u'a' && u <= u'z') {
+        return u - u'a' + 10;
+    }
+    if (u >= u'A' && u <= u'Z') {
+        return u - u'A' + 10;
+    }
+    return std::numeric_limits<int>::max();
+}
+} // namespace
+
+QBigInteger::QBigInteger(double value)
+{
+    if (!std::isfinite(value)) {
+        return;
+    }
+    negative = value < 0;
+    value = std::trunc(std::fabs(value));
+    // Dividing by a power of two is exact, so every limb is exact.
+    constexpr double limbBase = 4294967296.0;
+    while (value >= 1) {
+        limbs.append(static_cast<Limb>(std::fmod(value, limbBase)));
+        value = std::floor(value / limbBase);
+    }
+    negative = negative && !limbs.isEmpty();
+}
+
+QBigInteger QBigInteger::fromString(QStringView text, int base, bool *ok)
+{
+    if (ok) {
+        *ok = false;
+    }
+    if (base < 2 || base > 36) {
+        return {};
+    }
+
+    const bool negative = text.startsWith(u'-');
+    if (negative || text.startsWith(u'+')) {
+        text = text.sliced(1);
+    }
+    if (text.isEmpty()) {
+        return {};
+    }
+    for (const QChar c : text) {
+        if (digitValue(c) >= base) {
+            return {};
+        }
+    }
+
+    // Fixed size chunks from the end, the first one takes the leftover digits.
+    const Radix radix(base);
+    QList<Limb> chunks;
+    chunks.reserve(text.size() / radix.chunkDigits + 1);
+    qsizetype first = text.size() % radix.chunkDigits;
+    if (first == 0) {
+        first = radix.chunkDigits;
+    }
+    for (qsizetype i = 0; i < text.size();) {
+        const qsizetype length = i == 0 ? first : radix.chunkDigits;
+        Limb chunk = 0;
+        for (qsizetype j = i; j < i + length; ++j) {
+            chunk = chunk * base + static_cast<Limb>(digitValue(text.at(j)));
+        }
+        chunks.append(chunk);
+        i += length;
+    }
+
+    QList<Limbs> powers;
+    QBigInteger result;
+    result.limbs = combineChunks(chunks, 0, chunks.size(), powers, radix.chunk);
+    result.negative = negative && !result.limbs.isEmpty();
+    if (ok) {
+        *ok = true;
+    }
+    return result;
+}
+
+QString QBigInteger::toString(int base) const
+{
+    if (base < 2 || base > 36) {
+        return {};
+    }
+
+    QString out;
+    if (negative) {
+        out.append(u'-');
+    }
+    if (limbs.size() <= 2) {
+        // Up to 64 bits, no need for the divide and conquer machinery.
+        const quint64 magnitude = limbs.isEmpty() ? 0 : (limbs.size() == 1 ? limbs[0] : quint64(limbs[1]) << limbBits | limbs[0]);
+        return out + QString::number(magnitude, base);
+    }
+
+    const Radix radix(base);
+    QList<Limbs> powers;
+    ensurePowers(powers, radix.chunk, 1);
+    while (compareMagnitude(powers.last().data(), powers.last().size(), limbs.data(), limbs.size()) <= 0) {
+        ensurePowers(powers, radix.chunk, powers.size() + 1);
+    }
+    // Each power is divided by many times, its reciprocal is computed once.
+    QList<Limbs> reciprocals(powers.size());
+    for (qsizetype level = 0; level < powers.size() - 1; ++level) {
+        if (powers[level].size() > newtonThreshold) {
+            reciprocals[level] = reciprocal(powers[level]);
+        }
+    }
+    const Limbs magnitude(limbs);
+    appendDigits(out, magnitude, powers, reciprocals, powers.size() - 2, false, base, radix.chunkDigits);
+    return out;
+}
+
+double QBigInteger::toDouble() const noexcept
+{
+    double r = 0;
+    for (qsizetype i = limbs.size() - 1; i >= 0; --i) {
+        r = r * 4294967296.0 + limbs[i];
+    }
+    return negative ? -r : r;
+}
+
+QBigInteger QBigInteger::operator-() const
+{
+    QBigInteger r(*this);
+    r.negative = !negative && !limbs.isEmpty();
+    return r;
+}
+
+QBigInteger &QBigInteger::operator+=(const QBigInteger &other)
+{
+    if (negative == other.negative) {
+        limbs = addMagnitude(limbs.data(), limbs.size(), other.limbs.data(), other.limbs.size());
+    } else if (compareMagnitude(limbs.data(), limbs.size(), other.limbs.data(), other.limbs.size()) >= 0) {
+        limbs = subMagnitude(limbs.data(), limbs.size(), other.limbs.data(), other.limbs.size());
+    } else {
+        limbs = subMagnitude(other.limbs.data(), other.limbs.size(), limbs.data(), limbs.size());
+        negative = other.negative;
+    }
+    negative = negative && !limbs.isEmpty();
+    return *this;
+}
+
+QBigInteger &QBigInteger::operator-=(const QBigInteger &other)
+{
+    return *this += -other;
+}
+
+QBigInteger &QBigInteger::operator*=(const QBigInteger &other)
+{
+    limbs = mulMagnitude(limbs, other.limbs);
+    negative = negative != other.negative && !limbs.isEmpty();
+    return *this;
+}
+
+QBigInteger &QBigInteger::operator/=(const QBigInteger &other)
+{
+    Q_ASSERT_X(!other.isZero(), "QBigInteger::operator/=", "division by zero");
+    if (other.isZero()) {
+        return *this = QBigInteger();
+    }
+    Limbs q;
+    Limbs r;
+    divModMagnitude(limbs, other.limbs, &q, &r);
+    limbs = q;
+    negative = negative != other.negative && !limbs.isEmpty();
+    return *this;
+}
+
+QBigInteger &QBigInteger::operator%=(const QBigInteger &other)
+{
+    Q_ASSERT_X(!other.isZero(), "QBigInteger::operator%=", "division by zero");
+    if (other.isZero()) {
+        return *this = QBigInteger();
+    }
+    Limbs q;
+    Limbs r;
+    divModMagnitude(limbs, other.limbs, &q, &r);
+    limbs = r;
+    negative = negative && !limbs.isEmpty();
+    return *this;
+}
+
+int QBigInteger::compare(const QBigInteger &a, const QBigInteger &b) noexcept
+{
+    if (a.negative != b.negative) {
+        return a.negative ? -1 : 1;
+    }
+    const int c = compareMagnitude(a.limbs.data(), a.limbs.size(), b.limbs.data(), b.limbs.size());
+    return a.negative ? -c : c;
+}
+
+QDebug operator<<(QDebug debug, const QBigInteger &value)
+{
+    const QDebugStateSaver saver(debug);
+    debug.nospace().noquote() << value.toString();
+    return debug;
+}
+} // namespace QtExtraSpinBoxes
@@ -0,0 +1,588 @@
+// SPDX-FileCopyrightText: 2025 Trần Nam Tuấn <tuantran1632001@gmail.com>
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include "QtExtraSpinBoxes/qbigintegerspinbox.hpp"
+
+#include "QtExtraSpinBoxes/private/qextraspinbox_p.hpp"
+
+namespace QtExtraSpinBoxes
+{
+class QBigIntegerSpinBoxPrivate : public QExtraSpinBoxPrivate<QBigIntegerSpinBox::Type>
+{
+    Q_DISABLE_COPY(QBigIntegerSpinBoxPrivate)
+    Q_DECLARE_PUBLIC(QBigIntegerSpinBox)
+public:
+    explicit QBigIntegerSpinBoxPrivate(QBigIntegerSpinBox *qq)
+        : QExtraSpinBoxPrivate{qq}
+    {
+    }
+
+protected:
+    QLineEdit *q_edit() const override
+    {
+        Q_Q(const QBigIntegerSpinBox);
+        return q->lineEdit();
+    }
+
+    void q_initStyleOption(QStyleOptionSpinBox *option) const override
+    {
+        Q_Q(const QBigIntegerSpinBox);
+        return q->initStyleOption(option);
+    }
+
+    QAbstractSpinBox::StepEnabled q_stepEnabled() const override
+    {
+        Q_Q(const QBigIntegerSpinBox);
+        return q->stepEnabled();
+    }
+
+    QValidator::State q_validate(QString &input, int &pos) const override
+    {
+        Q_Q(const QBigIntegerSpinBox);
+        return q->validate(input, pos);
+    }
+
+    QString textFromValue(QBigIntegerSpinBox::Type value) const override
+    {
+        Q_Q(const QBigIntegerSpinBox);
+        return q->textFromValue(value);
+    }
+
+    QBigIntegerSpinBox::Type valueFromText(const QString &text) const override
+    {
+        Q_Q(const QBigIntegerSpinBox);
+        return q->valueFromText(text);
+    }
+
+    void emitSignalsImpl() override
+    {
+        Q_Q(QBigIntegerSpinBox);
+        if (q->isSignalConnected(QMetaMethod::fromSignal(&QBigIntegerSpinBox::textChanged))) {
+            Q_EMIT q->textChanged(displayText());
+        }
+        Q_EMIT q->valueChanged(value);
+        Q_EMIT q->valueChangedDetailed(lastEmittedValue, value, changeSource, interacting);
+    }
+
+    void emitFinishedImpl() override
+    {
+        Q_Q(QBigIntegerSpinBox);
+        Q_EMIT q->valueChangedDetailed(value, value, changeSource, false);
+    }
+};
+
+QBigIntegerSpinBox::QBigIntegerSpinBox(QWidget *parent)
+    : QAbstractSpinBox{parent}
+    , d_ptr{new QBigIntegerSpinBoxPrivate(this)}
+{
+    Q_D(QBigIntegerSpinBox);
+    d->init();
+}
+
+QBigIntegerSpinBox::~QBigIntegerSpinBox() = default;
+
+QString QBigIntegerSpinBox::cleanText() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->cleanText();
+}
+
+QBigIntegerSpinBox::Type QBigIntegerSpinBox::minimum() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->minimum;
+}
+
+void QBigIntegerSpinBox::setMinimum(Type minimum)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setMinimum(minimum);
+}
+
+QBigIntegerSpinBox::Type QBigIntegerSpinBox::maximum() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->maximum;
+}
+
+void QBigIntegerSpinBox::setMaximum(Type maximum)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setMaximum(maximum);
+}
+
+void QBigIntegerSpinBox::setRange(Type minimum, Type maximum)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setRange(minimum, maximum);
+}
+
+QList<QBigIntegerSpinBox::Type> QBigIntegerSpinBox::allowedValues() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->allowedValues;
+}
+
+void QBigIntegerSpinBox::setAllowedValues(const QList<Type> &values)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setAllowedValues(values);
+}
+
+QBigIntegerSpinBox::Type QBigIntegerSpinBox::singleStep() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->singleStep;
+}
+
+void QBigIntegerSpinBox::setSingleStep(Type value)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setSingleStep(value);
+}
+
+int QBigIntegerSpinBox::displayIntegerBase() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->displayIntegerBase;
+}
+
+void QBigIntegerSpinBox::setDisplayIntegerBase(int base)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setDisplayIntegerBase(base);
+}
+
+QString QBigIntegerSpinBox::prefix() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->prefix;
+}
+
+void QBigIntegerSpinBox::setPrefix(const QString &prefix)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setPrefix(prefix);
+}
+
+QString QBigIntegerSpinBox::suffix() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->suffix;
+}
+
+void QBigIntegerSpinBox::setSuffix(const QString &suffix)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setSuffix(suffix);
+}
+
+QAbstractSpinBox::StepType QBigIntegerSpinBox::stepType() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->stepType;
+}
+
+void QBigIntegerSpinBox::setStepType(StepType stepType)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->stepType = stepType;
+}
+
+int QBigIntegerSpinBox::adaptiveSignificantDigits() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->adaptiveSignificantDigits;
+}
+
+void QBigIntegerSpinBox::setAdaptiveSignificantDigits(int digits)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setAdaptiveSignificantDigits(digits);
+}
+
+StepMode QBigIntegerSpinBox::stepMode() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->stepMode;
+}
+
+void QBigIntegerSpinBox::setStepMode(StepMode mode)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->stepMode = mode;
+}
+
+QBigIntegerSpinBox::Type QBigIntegerSpinBox::stepFactor() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->stepFactor;
+}
+
+void QBigIntegerSpinBox::setStepFactor(Type factor)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setStepFactor(factor);
+}
+
+bool QBigIntegerSpinBox::isCursorDigitStepping() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->cursorDigitStepping;
+}
+
+void QBigIntegerSpinBox::setCursorDigitStepping(bool enable)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->cursorDigitStepping = enable;
+}
+
+bool QBigIntegerSpinBox::isChromeCached() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->chromeCached;
+}
+
+void QBigIntegerSpinBox::setChromeCached(bool enable)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setChromeCached(enable);
+}
+
+bool QBigIntegerSpinBox::isGlyphCached() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->glyphCached;
+}
+
+void QBigIntegerSpinBox::setGlyphCached(bool enable)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setGlyphCached(enable);
+}
+
+bool QBigIntegerSpinBox::isFramePaced() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->framePaced;
+}
+
+void QBigIntegerSpinBox::setFramePaced(bool enable)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setFramePaced(enable);
+}
+
+AccelerationCurve QBigIntegerSpinBox::accelerationCurve() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->accelerationCurve;
+}
+
+void QBigIntegerSpinBox::setAccelerationCurve(AccelerationCurve curve)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->accelerationCurve = curve;
+}
+
+void QBigIntegerSpinBox::setAccelerationFunction(const AccelerationFunction &function)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setAccelerationFunction(function);
+}
+
+WheelMode QBigIntegerSpinBox::wheelMode() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->wheelMode;
+}
+
+void QBigIntegerSpinBox::setWheelMode(WheelMode mode)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->wheelMode = mode;
+}
+
+bool QBigIntegerSpinBox::isScrubEnabled() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->scrubEnabled;
+}
+
+void QBigIntegerSpinBox::setScrubEnabled(bool enable)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->scrubEnabled = enable;
+}
+
+AccelerationCurve QBigIntegerSpinBox::scrubCurve() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->scrubCurve;
+}
+
+void QBigIntegerSpinBox::setScrubCurve(AccelerationCurve curve)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->scrubCurve = curve;
+}
+
+void QBigIntegerSpinBox::setScrubFunction(const ScrubFunction &function)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setScrubFunction(function);
+}
+
+int QBigIntegerSpinBox::keyboardTrackingDelay() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->keyboardTrackingDelay;
+}
+
+void QBigIntegerSpinBox::setKeyboardTrackingDelay(int msec)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setKeyboardTrackingDelay(msec);
+}
+
+int QBigIntegerSpinBox::emissionInterval() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->emissionInterval;
+}
+
+void QBigIntegerSpinBox::setEmissionInterval(int msec)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setEmissionInterval(msec);
+}
+
+bool QBigIntegerSpinBox::isInteracting() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->interacting;
+}
+
+QBigIntegerSpinBox::Type QBigIntegerSpinBox::deadband() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->deadband;
+}
+
+void QBigIntegerSpinBox::setDeadband(Type delta)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setDeadband(delta);
+}
+
+void QBigIntegerSpinBox::fixup(QString &input) const
+{
+    Q_D(const QBigIntegerSpinBox);
+    d->fixup(input);
+}
+
+void QBigIntegerSpinBox::stepBy(int steps)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->stepBy(steps);
+}
+
+void QBigIntegerSpinBox::stepUpBy(Type count)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->stepByWide(count, true);
+}
+
+void QBigIntegerSpinBox::stepDownBy(Type count)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->stepByWide(count, false);
+}
+
+void QBigIntegerSpinBox::stepTo(Type target)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->stepTo(target);
+}
+
+QValidator::State QBigIntegerSpinBox::validate(QString &input, int &pos) const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->validateImpl(input, pos);
+}
+
+bool QBigIntegerSpinBox::event(QEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    auto ret = d->event(event);
+    if (ret.has_value()) {
+        return ret.value();
+    }
+    return QWidget::event(event);
+}
+
+QBigIntegerSpinBox::Type QBigIntegerSpinBox::value() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->value;
+}
+
+QString QBigIntegerSpinBox::valueText() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->displayText();
+}
+
+QSize QBigIntegerSpinBox::minimumSizeHint() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->minimumSizeHint();
+}
+
+QSize QBigIntegerSpinBox::sizeHint() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->sizeHint();
+}
+
+void QBigIntegerSpinBox::clear()
+{
+    Q_D(QBigIntegerSpinBox);
+    d->clear();
+}
+
+void QBigIntegerSpinBox::setValue(Type value)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->setValue(value, EmitIfChanged);
+}
+
+QString QBigIntegerSpinBox::textFromValue(Type value) const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->textFromValueImpl(value);
+}
+
+void QBigIntegerSpinBox::initStyleOption(QStyleOptionSpinBox *option) const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->initStyleOptionImpl(option);
+}
+
+QAbstractSpinBox::StepEnabled QBigIntegerSpinBox::stepEnabled() const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->stepEnabledImpl();
+}
+
+QBigIntegerSpinBox::Type QBigIntegerSpinBox::valueFromText(const QString &text) const
+{
+    Q_D(const QBigIntegerSpinBox);
+    return d->valueFromTextImpl(text);
+}
+
+void QBigIntegerSpinBox::changeEvent(QEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->changeEvent(event);
+    QWidget::changeEvent(event);
+}
+
+void QBigIntegerSpinBox::closeEvent(QCloseEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->closeEvent(event);
+    QWidget::closeEvent(event);
+}
+
+#if QT_CONFIG(contextmenu)
+void QBigIntegerSpinBox::contextMenuEvent(QContextMenuEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->contextMenuEvent(event);
+    QWidget::contextMenuEvent(event);
+}
+#endif // QT_CONFIG(contextmenu)
+
+void QBigIntegerSpinBox::focusOutEvent(QFocusEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->focusOutEvent(event);
+    QWidget::focusOutEvent(event);
+    Q_EMIT editingFinished();
+}
+
+void QBigIntegerSpinBox::hideEvent(QHideEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->hideEvent(event);
+    QWidget::hideEvent(event);
+}
+
+void QBigIntegerSpinBox::keyPressEvent(QKeyEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->keyPressEvent(event);
+}
+
+void QBigIntegerSpinBox::keyReleaseEvent(QKeyEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->keyReleaseEvent(event);
+}
+
+void QBigIntegerSpinBox::mouseMoveEvent(QMouseEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->mouseMoveEvent(event);
+}
+
+void QBigIntegerSpinBox::mousePressEvent(QMouseEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->mousePressEvent(event);
+}
+
+void QBigIntegerSpinBox::mouseReleaseEvent(QMouseEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->mouseReleaseEvent(event);
+}
+
+void QBigIntegerSpinBox::paintEvent(QPaintEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    if (!d->paintEvent(event)) {
+        QAbstractSpinBox::paintEvent(event);
+    }
+}
+
+void QBigIntegerSpinBox::resizeEvent(QResizeEvent *event)
+{
+    QWidget::resizeEvent(event);
+
+    Q_D(QBigIntegerSpinBox);
+    d->resizeEvent(event);
+}
+
+void QBigIntegerSpinBox::showEvent(QShowEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->showEvent(event);
+}
+
+void QBigIntegerSpinBox::timerEvent(QTimerEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->timerEvent(event);
+    QWidget::timerEvent(event);
+}
+
+#if QT_CONFIG(wheelevent)
+void QBigIntegerSpinBox::wheelEvent(QWheelEvent *event)
+{
+    Q_D(QBigIntegerSpinBox);
+    d->wheelEvent(event);
+}
+#endif // QT_CONFIG(wheelevent)
+} // namespace QtExtraSpinBoxes
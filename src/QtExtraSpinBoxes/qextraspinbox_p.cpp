@@ -3,6 +3,374 @@
 
 #include "private/qextraspinbox_p.hpp"
 
+#include <QCoreApplication>
+#include <QPixmapCache>
+
+#include <cmath>
+
 namespace QtExtraSpinBoxes
 {
+QHash<QExtraSpinBoxChromeRenderer::Key, QPixmapCache::Key> QExtraSpinBoxChromeRenderer::keys;
+
+void QExtraSpinBoxChromeRenderer::draw(QPainter *painter, const QWidget *widget, const QStyleOptionSpinBox &option)
+{
+    // Any style sheet on the widget, an ancestor or the application puts a QStyleSheetStyle in front.
+    QStyle *style = widget->style();
+    if (style->inherits("QStyleSheetStyle")) {
+        style->drawComplexControl(QStyle::CC_SpinBox, &option, painter, widget);
+        return;
+    }
+
+    const qreal dpr = painter->device()->devicePixelRatioF();
+    const Key key = cacheKey(widget, option, dpr);
+
+    QPixmap pixmap;
+    auto it = keys.find(key);
+    if (it == keys.end() || !QPixmapCache::find(it.value(), &pixmap)) {
+        pixmap = QPixmap((QSizeF(option.rect.size()) * dpr).toSize());
+        pixmap.setDevicePixelRatio(dpr);
+        pixmap.fill(Qt::transparent);
+
+        QStyleOptionSpinBox opt = option;
+        opt.rect = QRect(QPoint(), option.rect.size());
+
+        QPainter pixmapPainter(&pixmap);
+        style->drawComplexControl(QStyle::CC_SpinBox, &opt, &pixmapPainter, widget);
+        pixmapPainter.end();
+
+        if (keys.isEmpty()) {
+            qAddPostRoutine(clearKeys);
+        } else if (it == keys.end() && keys.size() >= 256) {
+            // Most of these have been evicted from QPixmapCache by now.
+            keys.clear();
+        }
+        keys.insert(key, QPixmapCache::insert(pixmap));
+    }
+
+    painter->drawPixmap(option.rect.topLeft(), pixmap);
+}
+
+QExtraSpinBoxChromeRenderer::Key QExtraSpinBoxChromeRenderer::cacheKey(const QWidget *widget, const QStyleOptionSpinBox &option, qreal dpr)
+{
+    Key key;
+    key.style = styleSerial(widget->style());
+    key.size = option.rect.size();
+    key.state = option.state.toInt();
+    key.subControls = option.subControls.toInt();
+    key.activeSubControls = option.activeSubControls.toInt();
+    key.stepEnabled = option.stepEnabled.toInt();
+    key.buttonSymbols = option.buttonSymbols;
+    key.frame = option.frame;
+    key.direction = option.direction;
+    key.palette = option.palette.cacheKey();
+    key.dpr = dpr;
+    return key;
+}
+
+quint64 QExtraSpinBoxChromeRenderer::styleSerial(const QStyle *style)
+{
+    // Unlike the style's address, a serial is never reused by a later style.
+    static constexpr const char *property = "_qtextraspinboxes_serial";
+    static quint64 lastSerial = 0;
+
+    const QVariant serial = style->property(property);
+    if (serial.isValid()) {
+        return serial.toULongLong();
+    }
+    const_cast<QStyle *>(style)->setProperty(property, ++lastSerial);
+    return lastSerial;
+}
+
+void QExtraSpinBoxChromeRenderer::clearKeys()
+{
+    keys.clear();
+}
+
+QCache<QString, QExtraSpinBoxGlyphCache> QExtraSpinBoxGlyphCache::caches(8);
+
+QExtraSpinBoxGlyphCache *QExtraSpinBoxGlyphCache::forFont(const QFont &font)
+{
+    // The key leaves out kerning, which decides the pair advances.
+    const QString key = font.key() + (font.kerning() ? "_k"_L1 : "_n"_L1);
+    QExtraSpinBoxGlyphCache *cache = caches.object(key);
+    if (!cache) {
+        if (caches.isEmpty()) {
+            // Fonts and glyph runs must not outlive the application.
+            qAddPostRoutine(clearCaches);
+        }
+        cache = new QExtraSpinBoxGlyphCache(font);
+        caches.insert(key, cache);
+    }
+    return cache;
+}
+
+void QExtraSpinBoxGlyphCache::clearCaches()
+{
+    caches.clear();
+}
+
+QExtraSpinBoxGlyphCache::QExtraSpinBoxGlyphCache(const QFont &font)
+    : font{font}
+    , metrics{font}
+    , rawFont{QRawFont::fromFont(font)}
+{
+}
+
+void QExtraSpinBoxGlyphCache::draw(QPainter *painter,
+                                   const QRect &rect,
+                                   Qt::Alignment alignment,
+                                   QStringView prefix,
+                                   QStringView number,
+                                   QStringView suffix)
+{
+    // Same as the horizontal margin QLineEdit keeps around its text.
+    constexpr int horizontalMargin = 2;
+
+    qreal numberWidth = 0;
+    const bool assembled = layoutNumber(number, &numberWidth);
+    Run prefixRun;
+    Run suffixRun;
+    if (assembled) {
+        if (!prefix.isEmpty()) {
+            prefixRun = run(prefix.toString());
+        }
+        if (!suffix.isEmpty()) {
+            suffixRun = run(suffix.toString());
+        }
+    } else {
+        // A character the font lacks needs font fallback, which only the shaper does.
+        QString text;
+        text.reserve(prefix.size() + number.size() + suffix.size());
+        text.append(prefix).append(number).append(suffix);
+        prefixRun = run(text);
+    }
+    const qreal width = prefixRun.advance + numberWidth + suffixRun.advance;
+
+    const QRectF textRect = QRectF(rect).adjusted(horizontalMargin, 0, -horizontalMargin, 0);
+    const Qt::Alignment horizontal = QStyle::visualAlignment(painter->layoutDirection(), alignment) & Qt::AlignHorizontal_Mask;
+    qreal x = textRect.left();
+    if (horizontal & Qt::AlignRight) {
+        x = textRect.right() - width;
+    } else if (horizontal & Qt::AlignHCenter) {
+        x = textRect.left() + (textRect.width() - width) / 2;
+    }
+    const qreal y = textRect.top() + (textRect.height() - metrics.height()) / 2;
+
+    for (const QGlyphRun &glyphRun : std::as_const(prefixRun.glyphs)) {
+        painter->drawGlyphRun(QPointF(x, y), glyphRun);
+    }
+    x += prefixRun.advance;
+    if (assembled && !numberIndexes.isEmpty()) {
+        QGlyphRun numberRun;
+        numberRun.setRawFont(rawFont);
+        numberRun.setGlyphIndexes(numberIndexes);
+        numberRun.setPositions(numberPositions);
+        painter->drawGlyphRun(QPointF(x, y), numberRun);
+    }
+    x += numberWidth;
+    for (const QGlyphRun &glyphRun : std::as_const(suffixRun.glyphs)) {
+        painter->drawGlyphRun(QPointF(x, y), glyphRun);
+    }
+}
+
+QExtraSpinBoxGlyphCache::Glyph QExtraSpinBoxGlyphCache::glyph(char32_t c)
+{
+    auto it = glyphs.constFind(c);
+    if (it == glyphs.constEnd()) {
+        Glyph glyph;
+        const QList<quint32> indexes = rawFont.glyphIndexesForString(QString::fromUcs4(&c, 1));
+        if (indexes.size() == 1 && indexes.first() != 0) {
+            glyph.index = indexes.first();
+            glyph.advance = rawFont.advancesForGlyphIndexes(indexes).first().x();
+        }
+        it = glyphs.insert(c, glyph);
+    }
+    return it.value();
+}
+
+qreal QExtraSpinBoxGlyphCache::pairAdvance(const Glyph &left, const Glyph &right)
+{
+    if (!font.kerning()) {
+        return left.advance;
+    }
+    const quint64 key = (quint64(left.index) << 32) | right.index;
+    auto it = pairs.constFind(key);
+    if (it == pairs.constEnd()) {
+        const QList<QPointF> advances = rawFont.advancesForGlyphIndexes({left.index, right.index}, QRawFont::KernedAdvances);
+        it = pairs.insert(key, advances.first().x());
+    }
+    return it.value();
+}
+
+// Places the glyphs of number from the cache, starting at the baseline of the
+// origin. Returns false when the font lacks one of its characters.
+bool QExtraSpinBoxGlyphCache::layoutNumber(QStringView number, qreal *width)
+{
+    numberIndexes.clear();
+    numberPositions.clear();
+    if (!rawFont.isValid()) {
+        return number.isEmpty();
+    }
+
+    const qreal baseline = metrics.ascent();
+    qreal x = 0;
+    Glyph previous;
+    for (qsizetype i = 0; i < number.size(); ++i) {
+        char32_t c = number[i].unicode();
+        if (number[i].isHighSurrogate() && i + 1 < number.size() && number[i + 1].isLowSurrogate()) {
+            c = QChar::surrogateToUcs4(number[i], number[i + 1]);
+            ++i;
+        }
+        const Glyph current = glyph(c);
+        if (current.index == 0) {
+            numberIndexes.clear();
+            numberPositions.clear();
+            return false;
+        }
+        if (!numberIndexes.isEmpty()) {
+            x += pairAdvance(previous, current);
+        }
+        numberIndexes.append(current.index);
+        numberPositions.append(QPointF(x, baseline));
+        previous = current;
+    }
+    if (!numberIndexes.isEmpty()) {
+        x += previous.advance;
+    }
+    *width = x;
+    return true;
+}
+
+QExtraSpinBoxGlyphCache::Run QExtraSpinBoxGlyphCache::run(const QString &text)
+{
+    if (const Run *cached = runs.object(text)) {
+        return *cached;
+    }
+
+    // Lays the text out on a single line of unlimited width.
+    QTextLayout layout(text, font);
+    layout.beginLayout();
+    const QTextLine line = layout.createLine();
+    layout.endLayout();
+
+    auto *shaped = new Run;
+    shaped->glyphs = layout.glyphRuns();
+    shaped->advance = line.isValid() ? line.horizontalAdvance() : 0;
+    const Run result = *shaped;
+    runs.insert(text, shaped);
+    return result;
+}
+
+QExtraSpinBoxRepeatDriver::QExtraSpinBoxRepeatDriver(QObject *parent)
+    : QObject{parent}
+{
+}
+
+QExtraSpinBoxRepeatDriver *QExtraSpinBoxRepeatDriver::instance(bool create)
+{
+    // Owned by the application so that its timer never outlives the event dispatcher.
+    static QPointer<QExtraSpinBoxRepeatDriver> driver;
+    if (!driver && create) {
+        driver = new QExtraSpinBoxRepeatDriver(QCoreApplication::instance());
+    }
+    return driver;
+}
+
+void QExtraSpinBoxRepeatDriver::start(const void *owner,
+                                      std::chrono::milliseconds threshold,
+                                      std::chrono::milliseconds minimumInterval,
+                                      bool stepOnThreshold,
+                                      RateFunction rate,
+                                      StepFunction step)
+{
+    auto *driver = instance(true);
+    driver->owner = owner;
+    ++driver->generation;
+    driver->threshold = qMax(threshold, 0ms);
+    driver->lastTick = 0ns;
+    driver->minimumInterval = qMax(minimumInterval, 1ms);
+    driver->pendingSteps = 0;
+    driver->stepOnThreshold = stepOnThreshold;
+    driver->repeating = false;
+    driver->rate = std::move(rate);
+    driver->step = std::move(step);
+    driver->clock.start();
+    driver->timer.start(qMax(threshold, 0ms), Qt::PreciseTimer, driver);
+}
+
+void QExtraSpinBoxRepeatDriver::stop(const void *owner)
+{
+    auto *driver = instance(false);
+    if (driver && driver->owner == owner) {
+        driver->owner = nullptr;
+        ++driver->generation;
+        driver->timer.stop();
+        driver->rate = {};
+        driver->step = {};
+    }
+}
+
+bool QExtraSpinBoxRepeatDriver::isActive(const void *owner)
+{
+    const auto *driver = instance(false);
+    return driver && owner && driver->owner == owner;
+}
+
+bool QExtraSpinBoxRepeatDriver::isRepeating(const void *owner)
+{
+    const auto *driver = instance(false);
+    return isActive(owner) && driver->repeating;
+}
+
+void QExtraSpinBoxRepeatDriver::timerEvent(QTimerEvent *event)
+{
+    if (event->id() != timer.id()) {
+        QObject::timerEvent(event);
+        return;
+    }
+
+    const std::chrono::nanoseconds now = clock.durationElapsed();
+    if (now < threshold) {
+        timer.start(std::chrono::ceil<std::chrono::milliseconds>(threshold - now), Qt::PreciseTimer, this);
+        return;
+    }
+
+    if (!repeating) {
+        repeating = true;
+        lastTick = threshold;
+        if (stepOnThreshold) {
+            pendingSteps += 1;
+        }
+    }
+
+    // Integrate the rate over the time since the last tick, however late this tick is.
+    const std::chrono::nanoseconds middle = lastTick + (now - lastTick) / 2;
+    const qreal seconds = std::chrono::duration<qreal>(now - lastTick).count();
+    pendingSteps += qMax<qreal>(0, rate(std::chrono::duration_cast<std::chrono::milliseconds>(middle - threshold))) * seconds;
+    lastTick = now;
+
+    constexpr qreal maximumSteps = 1e18;
+    pendingSteps = qMin(pendingSteps, maximumSteps);
+    const qint64 steps = static_cast<qint64>(pendingSteps);
+    pendingSteps -= steps;
+
+    // The step may stop or restart the repeat, e.g. when reaching a bound.
+    const quint64 currentGeneration = generation;
+    if (steps > 0) {
+        const qint64 remaining = step(steps);
+        if (currentGeneration == generation) {
+            pendingSteps = qMin(pendingSteps + remaining, maximumSteps);
+        }
+    }
+    if (currentGeneration != generation) {
+        return;
+    }
+
+    const qreal currentRate = rate(std::chrono::duration_cast<std::chrono::milliseconds>(now - threshold));
+    std::chrono::milliseconds interval = minimumInterval;
+    if (currentRate > 0) {
+        interval = std::chrono::ceil<std::chrono::milliseconds>(std::chrono::duration<qreal>((1 - pendingSteps) / currentRate));
+    }
+    timer.start(qBound(minimumInterval, interval, std::chrono::milliseconds(1s)), Qt::PreciseTimer, this);
+}
 } // namespace QtExtraSpinBoxes
@@ -0,0 +1,607 @@
+// SPDX-FileCopyrightText: 2025 Trần Nam Tuấn <tuantran1632001@gmail.com>
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include "QtExtraSpinBoxes/qfixedpoint64spinbox.hpp"
+
+#include "QtExtraSpinBoxes/private/qextraspinbox_p.hpp"
+
+namespace QtExtraSpinBoxes
+{
+class QFixedPoint64SpinBoxPrivate : public QExtraSpinBoxPrivate<QFixedPoint64SpinBox::Type>
+{
+    Q_DISABLE_COPY(QFixedPoint64SpinBoxPrivate)
+    Q_DECLARE_PUBLIC(QFixedPoint64SpinBox)
+public:
+    explicit QFixedPoint64SpinBoxPrivate(QFixedPoint64SpinBox *qq)
+        : QExtraSpinBoxPrivate{qq}
+    {
+    }
+
+protected:
+    QLineEdit *q_edit() const override
+    {
+        Q_Q(const QFixedPoint64SpinBox);
+        return q->lineEdit();
+    }
+
+    void q_initStyleOption(QStyleOptionSpinBox *option) const override
+    {
+        Q_Q(const QFixedPoint64SpinBox);
+        return q->initStyleOption(option);
+    }
+
+    QAbstractSpinBox::StepEnabled q_stepEnabled() const override
+    {
+        Q_Q(const QFixedPoint64SpinBox);
+        return q->stepEnabled();
+    }
+
+    QValidator::State q_validate(QString &input, int &pos) const override
+    {
+        Q_Q(const QFixedPoint64SpinBox);
+        return q->validate(input, pos);
+    }
+
+    QString textFromValue(QFixedPoint64SpinBox::Type value) const override
+    {
+        Q_Q(const QFixedPoint64SpinBox);
+        return q->textFromValue(value);
+    }
+
+    QFixedPoint64SpinBox::Type valueFromText(const QString &text) const override
+    {
+        Q_Q(const QFixedPoint64SpinBox);
+        return q->valueFromText(text);
+    }
+
+    void emitSignalsImpl() override
+    {
+        Q_Q(QFixedPoint64SpinBox);
+        if (q->isSignalConnected(QMetaMethod::fromSignal(&QFixedPoint64SpinBox::textChanged))) {
+            Q_EMIT q->textChanged(displayText());
+        }
+        Q_EMIT q->valueChanged(value);
+        Q_EMIT q->valueChangedDetailed(lastEmittedValue, value, changeSource, interacting);
+    }
+
+    void emitFinishedImpl() override
+    {
+        Q_Q(QFixedPoint64SpinBox);
+        Q_EMIT q->valueChangedDetailed(value, value, changeSource, false);
+    }
+};
+
+QFixedPoint64SpinBox::QFixedPoint64SpinBox(int decimals, QWidget *parent)
+    : QAbstractSpinBox{parent}
+    , d_ptr{new QFixedPoint64SpinBoxPrivate(this)}
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->init();
+    d->setDecimals(decimals);
+}
+
+QFixedPoint64SpinBox::~QFixedPoint64SpinBox() = default;
+
+QString QFixedPoint64SpinBox::cleanText() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->cleanText();
+}
+
+QFixedPoint64SpinBox::Type QFixedPoint64SpinBox::minimum() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->minimum;
+}
+
+void QFixedPoint64SpinBox::setMinimum(Type minimum)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setMinimum(minimum);
+}
+
+QFixedPoint64SpinBox::Type QFixedPoint64SpinBox::maximum() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->maximum;
+}
+
+void QFixedPoint64SpinBox::setMaximum(Type maximum)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setMaximum(maximum);
+}
+
+void QFixedPoint64SpinBox::setRange(Type minimum, Type maximum)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setRange(minimum, maximum);
+}
+
+QList<QFixedPoint64SpinBox::Type> QFixedPoint64SpinBox::allowedValues() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->allowedValues;
+}
+
+void QFixedPoint64SpinBox::setAllowedValues(const QList<Type> &values)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setAllowedValues(values);
+}
+
+QFixedPoint64SpinBox::Type QFixedPoint64SpinBox::singleStep() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->singleStep;
+}
+
+void QFixedPoint64SpinBox::setSingleStep(Type value)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setSingleStep(value);
+}
+
+int QFixedPoint64SpinBox::displayIntegerBase() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->displayIntegerBase;
+}
+
+void QFixedPoint64SpinBox::setDisplayIntegerBase(int base)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setDisplayIntegerBase(base);
+}
+
+int QFixedPoint64SpinBox::decimals() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->decimals;
+}
+
+QString QFixedPoint64SpinBox::prefix() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->prefix;
+}
+
+void QFixedPoint64SpinBox::setPrefix(const QString &prefix)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setPrefix(prefix);
+}
+
+QString QFixedPoint64SpinBox::suffix() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->suffix;
+}
+
+void QFixedPoint64SpinBox::setSuffix(const QString &suffix)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setSuffix(suffix);
+}
+
+QAbstractSpinBox::StepType QFixedPoint64SpinBox::stepType() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->stepType;
+}
+
+void QFixedPoint64SpinBox::setStepType(StepType stepType)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->stepType = stepType;
+}
+
+int QFixedPoint64SpinBox::adaptiveSignificantDigits() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->adaptiveSignificantDigits;
+}
+
+void QFixedPoint64SpinBox::setAdaptiveSignificantDigits(int digits)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setAdaptiveSignificantDigits(digits);
+}
+
+StepMode QFixedPoint64SpinBox::stepMode() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->stepMode;
+}
+
+void QFixedPoint64SpinBox::setStepMode(StepMode mode)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->stepMode = mode;
+}
+
+QFixedPoint64SpinBox::Type QFixedPoint64SpinBox::stepFactor() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->stepFactor;
+}
+
+void QFixedPoint64SpinBox::setStepFactor(Type factor)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setStepFactor(factor);
+}
+
+OverflowPolicy QFixedPoint64SpinBox::overflowPolicy() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->overflowPolicy;
+}
+
+void QFixedPoint64SpinBox::setOverflowPolicy(OverflowPolicy policy)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->overflowPolicy = policy;
+}
+
+bool QFixedPoint64SpinBox::isCursorDigitStepping() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->cursorDigitStepping;
+}
+
+void QFixedPoint64SpinBox::setCursorDigitStepping(bool enable)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->cursorDigitStepping = enable;
+}
+
+bool QFixedPoint64SpinBox::isChromeCached() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->chromeCached;
+}
+
+void QFixedPoint64SpinBox::setChromeCached(bool enable)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setChromeCached(enable);
+}
+
+bool QFixedPoint64SpinBox::isGlyphCached() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->glyphCached;
+}
+
+void QFixedPoint64SpinBox::setGlyphCached(bool enable)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setGlyphCached(enable);
+}
+
+bool QFixedPoint64SpinBox::isFramePaced() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->framePaced;
+}
+
+void QFixedPoint64SpinBox::setFramePaced(bool enable)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setFramePaced(enable);
+}
+
+AccelerationCurve QFixedPoint64SpinBox::accelerationCurve() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->accelerationCurve;
+}
+
+void QFixedPoint64SpinBox::setAccelerationCurve(AccelerationCurve curve)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->accelerationCurve = curve;
+}
+
+void QFixedPoint64SpinBox::setAccelerationFunction(const AccelerationFunction &function)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setAccelerationFunction(function);
+}
+
+WheelMode QFixedPoint64SpinBox::wheelMode() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->wheelMode;
+}
+
+void QFixedPoint64SpinBox::setWheelMode(WheelMode mode)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->wheelMode = mode;
+}
+
+bool QFixedPoint64SpinBox::isScrubEnabled() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->scrubEnabled;
+}
+
+void QFixedPoint64SpinBox::setScrubEnabled(bool enable)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->scrubEnabled = enable;
+}
+
+AccelerationCurve QFixedPoint64SpinBox::scrubCurve() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->scrubCurve;
+}
+
+void QFixedPoint64SpinBox::setScrubCurve(AccelerationCurve curve)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->scrubCurve = curve;
+}
+
+void QFixedPoint64SpinBox::setScrubFunction(const ScrubFunction &function)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setScrubFunction(function);
+}
+
+int QFixedPoint64SpinBox::keyboardTrackingDelay() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->keyboardTrackingDelay;
+}
+
+void QFixedPoint64SpinBox::setKeyboardTrackingDelay(int msec)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setKeyboardTrackingDelay(msec);
+}
+
+int QFixedPoint64SpinBox::emissionInterval() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->emissionInterval;
+}
+
+void QFixedPoint64SpinBox::setEmissionInterval(int msec)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setEmissionInterval(msec);
+}
+
+bool QFixedPoint64SpinBox::isInteracting() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->interacting;
+}
+
+QFixedPoint64SpinBox::Type QFixedPoint64SpinBox::deadband() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->deadband;
+}
+
+void QFixedPoint64SpinBox::setDeadband(Type delta)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setDeadband(delta);
+}
+
+void QFixedPoint64SpinBox::fixup(QString &input) const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    d->fixup(input);
+}
+
+void QFixedPoint64SpinBox::stepBy(int steps)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->stepBy(steps);
+}
+
+void QFixedPoint64SpinBox::stepUpBy(Type count)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->stepByWide(count, true);
+}
+
+void QFixedPoint64SpinBox::stepDownBy(Type count)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->stepByWide(count, false);
+}
+
+void QFixedPoint64SpinBox::stepTo(Type target)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->stepTo(target);
+}
+
+QValidator::State QFixedPoint64SpinBox::validate(QString &input, int &pos) const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->validateImpl(input, pos);
+}
+
+bool QFixedPoint64SpinBox::event(QEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    auto ret = d->event(event);
+    if (ret.has_value()) {
+        return ret.value();
+    }
+    return QWidget::event(event);
+}
+
+QFixedPoint64SpinBox::Type QFixedPoint64SpinBox::value() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->value;
+}
+
+QString QFixedPoint64SpinBox::valueText() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->displayText();
+}
+
+QSize QFixedPoint64SpinBox::minimumSizeHint() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->minimumSizeHint();
+}
+
+QSize QFixedPoint64SpinBox::sizeHint() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->sizeHint();
+}
+
+void QFixedPoint64SpinBox::clear()
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->clear();
+}
+
+void QFixedPoint64SpinBox::setValue(Type value)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->setValue(value, EmitIfChanged);
+}
+
+QString QFixedPoint64SpinBox::textFromValue(Type value) const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->textFromValueImpl(value);
+}
+
+void QFixedPoint64SpinBox::initStyleOption(QStyleOptionSpinBox *option) const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->initStyleOptionImpl(option);
+}
+
+QAbstractSpinBox::StepEnabled QFixedPoint64SpinBox::stepEnabled() const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->stepEnabledImpl();
+}
+
+QFixedPoint64SpinBox::Type QFixedPoint64SpinBox::valueFromText(const QString &text) const
+{
+    Q_D(const QFixedPoint64SpinBox);
+    return d->valueFromTextImpl(text);
+}
+
+void QFixedPoint64SpinBox::changeEvent(QEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->changeEvent(event);
+    QWidget::changeEvent(event);
+}
+
+void QFixedPoint64SpinBox::closeEvent(QCloseEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->closeEvent(event);
+    QWidget::closeEvent(event);
+}
+
+#if QT_CONFIG(contextmenu)
+void QFixedPoint64SpinBox::contextMenuEvent(QContextMenuEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->contextMenuEvent(event);
+    QWidget::contextMenuEvent(event);
+}
+#endif // QT_CONFIG(contextmenu)
+
+void QFixedPoint64SpinBox::focusOutEvent(QFocusEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->focusOutEvent(event);
+    QWidget::focusOutEvent(event);
+    Q_EMIT editingFinished();
+}
+
+void QFixedPoint64SpinBox::hideEvent(QHideEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->hideEvent(event);
+    QWidget::hideEvent(event);
+}
+
+void QFixedPoint64SpinBox::keyPressEvent(QKeyEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->keyPressEvent(event);
+}
+
+void QFixedPoint64SpinBox::keyReleaseEvent(QKeyEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->keyReleaseEvent(event);
+}
+
+void QFixedPoint64SpinBox::mouseMoveEvent(QMouseEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->mouseMoveEvent(event);
+}
+
+void QFixedPoint64SpinBox::mousePressEvent(QMouseEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->mousePressEvent(event);
+}
+
+void QFixedPoint64SpinBox::mouseReleaseEvent(QMouseEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->mouseReleaseEvent(event);
+}
+
+void QFixedPoint64SpinBox::paintEvent(QPaintEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    if (!d->paintEvent(event)) {
+        QAbstractSpinBox::paintEvent(event);
+    }
+}
+
+void QFixedPoint64SpinBox::resizeEvent(QResizeEvent *event)
+{
+    QWidget::resizeEvent(event);
+
+    Q_D(QFixedPoint64SpinBox);
+    d->resizeEvent(event);
+}
+
+void QFixedPoint64SpinBox::showEvent(QShowEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->showEvent(event);
+}
+
+void QFixedPoint64SpinBox::timerEvent(QTimerEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->timerEvent(event);
+    QWidget::timerEvent(event);
+}
+
+#if QT_CONFIG(wheelevent)
+void QFixedPoint64SpinBox::wheelEvent(QWheelEvent *event)
+{
+    Q_D(QFixedPoint64SpinBox);
+    d->wheelEvent(event);
+}
+#endif // QT_CONFIG(wheelevent)
+} // namespace QtExtraSpinBoxes
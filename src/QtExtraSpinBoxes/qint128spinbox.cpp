@@ -0,0 +1,602 @@
+// SPDX-FileCopyrightText: 2025 Trần Nam Tuấn <tuantran1632001@gmail.com>
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include "QtExtraSpinBoxes/qint128spinbox.hpp"
+
+#ifdef QT_SUPPORTS_INT128
+#include "QtExtraSpinBoxes/private/qextraspinbox_p.hpp"
+
+namespace QtExtraSpinBoxes
+{
+class QInt128SpinBoxPrivate : public QExtraSpinBoxPrivate<QInt128SpinBox::Type>
+{
+    Q_DISABLE_COPY(QInt128SpinBoxPrivate)
+    Q_DECLARE_PUBLIC(QInt128SpinBox)
+public:
+    explicit QInt128SpinBoxPrivate(QInt128SpinBox *qq)
+        : QExtraSpinBoxPrivate{qq}
+    {
+    }
+
+protected:
+    QLineEdit *q_edit() const override
+    {
+        Q_Q(const QInt128SpinBox);
+        return q->lineEdit();
+    }
+
+    void q_initStyleOption(QStyleOptionSpinBox *option) const override
+    {
+        Q_Q(const QInt128SpinBox);
+        return q->initStyleOption(option);
+    }
+
+    QAbstractSpinBox::StepEnabled q_stepEnabled() const override
+    {
+        Q_Q(const QInt128SpinBox);
+        return q->stepEnabled();
+    }
+
+    QValidator::State q_validate(QString &input, int &pos) const override
+    {
+        Q_Q(const QInt128SpinBox);
+        return q->validate(input, pos);
+    }
+
+    QString textFromValue(QInt128SpinBox::Type value) const override
+    {
+        Q_Q(const QInt128SpinBox);
+        return q->textFromValue(value);
+    }
+
+    QInt128SpinBox::Type valueFromText(const QString &text) const override
+    {
+        Q_Q(const QInt128SpinBox);
+        return q->valueFromText(text);
+    }
+
+    void emitSignalsImpl() override
+    {
+        Q_Q(QInt128SpinBox);
+        if (q->isSignalConnected(QMetaMethod::fromSignal(&QInt128SpinBox::textChanged))) {
+            Q_EMIT q->textChanged(displayText());
+        }
+        Q_EMIT q->valueChanged(value);
+        Q_EMIT q->valueChangedDetailed(lastEmittedValue, value, changeSource, interacting);
+    }
+
+    void emitFinishedImpl() override
+    {
+        Q_Q(QInt128SpinBox);
+        Q_EMIT q->valueChangedDetailed(value, value, changeSource, false);
+    }
+};
+
+QInt128SpinBox::QInt128SpinBox(QWidget *parent)
+    : QAbstractSpinBox{parent}
+    , d_ptr{new QInt128SpinBoxPrivate(this)}
+{
+    Q_D(QInt128SpinBox);
+    d->init();
+}
+
+QInt128SpinBox::~QInt128SpinBox() = default;
+
+QString QInt128SpinBox::cleanText() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->cleanText();
+}
+
+QInt128SpinBox::Type QInt128SpinBox::minimum() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->minimum;
+}
+
+void QInt128SpinBox::setMinimum(Type minimum)
+{
+    Q_D(QInt128SpinBox);
+    d->setMinimum(minimum);
+}
+
+QInt128SpinBox::Type QInt128SpinBox::maximum() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->maximum;
+}
+
+void QInt128SpinBox::setMaximum(Type maximum)
+{
+    Q_D(QInt128SpinBox);
+    d->setMaximum(maximum);
+}
+
+void QInt128SpinBox::setRange(Type minimum, Type maximum)
+{
+    Q_D(QInt128SpinBox);
+    d->setRange(minimum, maximum);
+}
+
+QList<QInt128SpinBox::Type> QInt128SpinBox::allowedValues() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->allowedValues;
+}
+
+void QInt128SpinBox::setAllowedValues(const QList<Type> &values)
+{
+    Q_D(QInt128SpinBox);
+    d->setAllowedValues(values);
+}
+
+QInt128SpinBox::Type QInt128SpinBox::singleStep() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->singleStep;
+}
+
+void QInt128SpinBox::setSingleStep(Type value)
+{
+    Q_D(QInt128SpinBox);
+    d->setSingleStep(value);
+}
+
+int QInt128SpinBox::displayIntegerBase() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->displayIntegerBase;
+}
+
+void QInt128SpinBox::setDisplayIntegerBase(int base)
+{
+    Q_D(QInt128SpinBox);
+    d->setDisplayIntegerBase(base);
+}
+
+QString QInt128SpinBox::prefix() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->prefix;
+}
+
+void QInt128SpinBox::setPrefix(const QString &prefix)
+{
+    Q_D(QInt128SpinBox);
+    d->setPrefix(prefix);
+}
+
+QString QInt128SpinBox::suffix() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->suffix;
+}
+
+void QInt128SpinBox::setSuffix(const QString &suffix)
+{
+    Q_D(QInt128SpinBox);
+    d->setSuffix(suffix);
+}
+
+QAbstractSpinBox::StepType QInt128SpinBox::stepType() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->stepType;
+}
+
+void QInt128SpinBox::setStepType(StepType stepType)
+{
+    Q_D(QInt128SpinBox);
+    d->stepType = stepType;
+}
+
+int QInt128SpinBox::adaptiveSignificantDigits() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->adaptiveSignificantDigits;
+}
+
+void QInt128SpinBox::setAdaptiveSignificantDigits(int digits)
+{
+    Q_D(QInt128SpinBox);
+    d->setAdaptiveSignificantDigits(digits);
+}
+
+StepMode QInt128SpinBox::stepMode() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->stepMode;
+}
+
+void QInt128SpinBox::setStepMode(StepMode mode)
+{
+    Q_D(QInt128SpinBox);
+    d->stepMode = mode;
+}
+
+QInt128SpinBox::Type QInt128SpinBox::stepFactor() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->stepFactor;
+}
+
+void QInt128SpinBox::setStepFactor(Type factor)
+{
+    Q_D(QInt128SpinBox);
+    d->setStepFactor(factor);
+}
+
+OverflowPolicy QInt128SpinBox::overflowPolicy() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->overflowPolicy;
+}
+
+void QInt128SpinBox::setOverflowPolicy(OverflowPolicy policy)
+{
+    Q_D(QInt128SpinBox);
+    d->overflowPolicy = policy;
+}
+
+bool QInt128SpinBox::isCursorDigitStepping() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->cursorDigitStepping;
+}
+
+void QInt128SpinBox::setCursorDigitStepping(bool enable)
+{
+    Q_D(QInt128SpinBox);
+    d->cursorDigitStepping = enable;
+}
+
+bool QInt128SpinBox::isChromeCached() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->chromeCached;
+}
+
+void QInt128SpinBox::setChromeCached(bool enable)
+{
+    Q_D(QInt128SpinBox);
+    d->setChromeCached(enable);
+}
+
+bool QInt128SpinBox::isGlyphCached() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->glyphCached;
+}
+
+void QInt128SpinBox::setGlyphCached(bool enable)
+{
+    Q_D(QInt128SpinBox);
+    d->setGlyphCached(enable);
+}
+
+bool QInt128SpinBox::isFramePaced() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->framePaced;
+}
+
+void QInt128SpinBox::setFramePaced(bool enable)
+{
+    Q_D(QInt128SpinBox);
+    d->setFramePaced(enable);
+}
+
+AccelerationCurve QInt128SpinBox::accelerationCurve() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->accelerationCurve;
+}
+
+void QInt128SpinBox::setAccelerationCurve(AccelerationCurve curve)
+{
+    Q_D(QInt128SpinBox);
+    d->accelerationCurve = curve;
+}
+
+void QInt128SpinBox::setAccelerationFunction(const AccelerationFunction &function)
+{
+    Q_D(QInt128SpinBox);
+    d->setAccelerationFunction(function);
+}
+
+WheelMode QInt128SpinBox::wheelMode() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->wheelMode;
+}
+
+void QInt128SpinBox::setWheelMode(WheelMode mode)
+{
+    Q_D(QInt128SpinBox);
+    d->wheelMode = mode;
+}
+
+bool QInt128SpinBox::isScrubEnabled() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->scrubEnabled;
+}
+
+void QInt128SpinBox::setScrubEnabled(bool enable)
+{
+    Q_D(QInt128SpinBox);
+    d->scrubEnabled = enable;
+}
+
+AccelerationCurve QInt128SpinBox::scrubCurve() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->scrubCurve;
+}
+
+void QInt128SpinBox::setScrubCurve(AccelerationCurve curve)
+{
+    Q_D(QInt128SpinBox);
+    d->scrubCurve = curve;
+}
+
+void QInt128SpinBox::setScrubFunction(const ScrubFunction &function)
+{
+    Q_D(QInt128SpinBox);
+    d->setScrubFunction(function);
+}
+
+int QInt128SpinBox::keyboardTrackingDelay() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->keyboardTrackingDelay;
+}
+
+void QInt128SpinBox::setKeyboardTrackingDelay(int msec)
+{
+    Q_D(QInt128SpinBox);
+    d->setKeyboardTrackingDelay(msec);
+}
+
+int QInt128SpinBox::emissionInterval() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->emissionInterval;
+}
+
+void QInt128SpinBox::setEmissionInterval(int msec)
+{
+    Q_D(QInt128SpinBox);
+    d->setEmissionInterval(msec);
+}
+
+bool QInt128SpinBox::isInteracting() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->interacting;
+}
+
+QInt128SpinBox::Type QInt128SpinBox::deadband() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->deadband;
+}
+
+void QInt128SpinBox::setDeadband(Type delta)
+{
+    Q_D(QInt128SpinBox);
+    d->setDeadband(delta);
+}
+
+void QInt128SpinBox::fixup(QString &input) const
+{
+    Q_D(const QInt128SpinBox);
+    d->fixup(input);
+}
+
+void QInt128SpinBox::stepBy(int steps)
+{
+    Q_D(QInt128SpinBox);
+    d->stepBy(steps);
+}
+
+void QInt128SpinBox::stepUpBy(Type count)
+{
+    Q_D(QInt128SpinBox);
+    d->stepByWide(count, true);
+}
+
+void QInt128SpinBox::stepDownBy(Type count)
+{
+    Q_D(QInt128SpinBox);
+    d->stepByWide(count, false);
+}
+
+void QInt128SpinBox::stepTo(Type target)
+{
+    Q_D(QInt128SpinBox);
+    d->stepTo(target);
+}
+
+QValidator::State QInt128SpinBox::validate(QString &input, int &pos) const
+{
+    Q_D(const QInt128SpinBox);
+    return d->validateImpl(input, pos);
+}
+
+bool QInt128SpinBox::event(QEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    auto ret = d->event(event);
+    if (ret.has_value()) {
+        return ret.value();
+    }
+    return QWidget::event(event);
+}
+
+QInt128SpinBox::Type QInt128SpinBox::value() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->value;
+}
+
+QString QInt128SpinBox::valueText() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->displayText();
+}
+
+QSize QInt128SpinBox::minimumSizeHint() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->minimumSizeHint();
+}
+
+QSize QInt128SpinBox::sizeHint() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->sizeHint();
+}
+
+void QInt128SpinBox::clear()
+{
+    Q_D(QInt128SpinBox);
+    d->clear();
+}
+
+void QInt128SpinBox::setValue(Type value)
+{
+    Q_D(QInt128SpinBox);
+    d->setValue(value, EmitIfChanged);
+}
+
+QString QInt128SpinBox::textFromValue(Type value) const
+{
+    Q_D(const QInt128SpinBox);
+    return d->textFromValueImpl(value);
+}
+
+void QInt128SpinBox::initStyleOption(QStyleOptionSpinBox *option) const
+{
+    Q_D(const QInt128SpinBox);
+    return d->initStyleOptionImpl(option);
+}
+
+QAbstractSpinBox::StepEnabled QInt128SpinBox::stepEnabled() const
+{
+    Q_D(const QInt128SpinBox);
+    return d->stepEnabledImpl();
+}
+
+QInt128SpinBox::Type QInt128SpinBox::valueFromText(const QString &text) const
+{
+    Q_D(const QInt128SpinBox);
+    return d->valueFromTextImpl(text);
+}
+
+void QInt128SpinBox::changeEvent(QEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    d->changeEvent(event);
+    QWidget::changeEvent(event);
+}
+
+void QInt128SpinBox::closeEvent(QCloseEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    d->closeEvent(event);
+    QWidget::closeEvent(event);
+}
+
+#if QT_CONFIG(contextmenu)
+void QInt128SpinBox::contextMenuEvent(QContextMenuEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    d->contextMenuEvent(event);
+    QWidget::contextMenuEvent(event);
+}
+#endif // QT_CONFIG(contextmenu)
+
+void QInt128SpinBox::focusOutEvent(QFocusEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    d->focusOutEvent(event);
+    QWidget::focusOutEvent(event);
+    Q_EMIT editingFinished();
+}
+
+void QInt128SpinBox::hideEvent(QHideEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    d->hideEvent(event);
+    QWidget::hideEvent(event);
+}
+
+void QInt128SpinBox::keyPressEvent(QKeyEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    d->keyPressEvent(event);
+}
+
+void QInt128SpinBox::keyReleaseEvent(QKeyEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    d->keyReleaseEvent(event);
+}
+
+void QInt128SpinBox::mouseMoveEvent(QMouseEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    d->mouseMoveEvent(event);
+}
+
+void QInt128SpinBox::mousePressEvent(QMouseEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    d->mousePressEvent(event);
+}
+
+void QInt128SpinBox::mouseReleaseEvent(QMouseEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    d->mouseReleaseEvent(event);
+}
+
+void QInt128SpinBox::paintEvent(QPaintEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    if (!d->paintEvent(event)) {
+        QAbstractSpinBox::paintEvent(event);
+    }
+}
+
+void QInt128SpinBox::resizeEvent(QResizeEvent *event)
+{
+    QWidget::resizeEvent(event);
+
+    Q_D(QInt128SpinBox);
+    d->resizeEvent(event);
+}
+
+void QInt128SpinBox::showEvent(QShowEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    d->showEvent(event);
+}
+
+void QInt128SpinBox::timerEvent(QTimerEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    d->timerEvent(event);
+    QWidget::timerEvent(event);
+}
+
+#if QT_CONFIG(wheelevent)
+void QInt128SpinBox::wheelEvent(QWheelEvent *event)
+{
+    Q_D(QInt128SpinBox);
+    d->wheelEvent(event);
+}
+#endif // QT_CONFIG(wheelevent)
+} // namespace QtExtraSpinBoxes
+#endif // QT_SUPPORTS_INT128
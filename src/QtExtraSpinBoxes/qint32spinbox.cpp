@@ -58,8 +58,17 @@ protected:
     void emitSignalsImpl() override
     {
         Q_Q(QInt32SpinBox);
-        Q_EMIT q->textChanged(q_edit()->displayText());
+        if (q->isSignalConnected(QMetaMethod::fromSignal(&QInt32SpinBox::textChanged))) {
+            Q_EMIT q->textChanged(displayText());
+        }
         Q_EMIT q->valueChanged(value);
+        Q_EMIT q->valueChangedDetailed(lastEmittedValue, value, changeSource, interacting);
+    }
+
+    void emitFinishedImpl() override
+    {
+        Q_Q(QInt32SpinBox);
+        Q_EMIT q->valueChangedDetailed(value, value, changeSource, false);
     }
 };
 
@@ -109,6 +118,18 @@ void QInt32SpinBox::setRange(Type minimum, Type maximum)
     d->setRange(minimum, maximum);
 }
 
+QList<QInt32SpinBox::Type> QInt32SpinBox::allowedValues() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->allowedValues;
+}
+
+void QInt32SpinBox::setAllowedValues(const QList<Type> &values)
+{
+    Q_D(QInt32SpinBox);
+    d->setAllowedValues(values);
+}
+
 QInt32SpinBox::Type QInt32SpinBox::singleStep() const
 {
     Q_D(const QInt32SpinBox);
@@ -169,6 +190,204 @@ void QInt32SpinBox::setStepType(StepType stepType)
     d->stepType = stepType;
 }
 
+int QInt32SpinBox::adaptiveSignificantDigits() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->adaptiveSignificantDigits;
+}
+
+void QInt32SpinBox::setAdaptiveSignificantDigits(int digits)
+{
+    Q_D(QInt32SpinBox);
+    d->setAdaptiveSignificantDigits(digits);
+}
+
+StepMode QInt32SpinBox::stepMode() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->stepMode;
+}
+
+void QInt32SpinBox::setStepMode(StepMode mode)
+{
+    Q_D(QInt32SpinBox);
+    d->stepMode = mode;
+}
+
+QInt32SpinBox::Type QInt32SpinBox::stepFactor() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->stepFactor;
+}
+
+void QInt32SpinBox::setStepFactor(Type factor)
+{
+    Q_D(QInt32SpinBox);
+    d->setStepFactor(factor);
+}
+
+OverflowPolicy QInt32SpinBox::overflowPolicy() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->overflowPolicy;
+}
+
+void QInt32SpinBox::setOverflowPolicy(OverflowPolicy policy)
+{
+    Q_D(QInt32SpinBox);
+    d->overflowPolicy = policy;
+}
+
+bool QInt32SpinBox::isCursorDigitStepping() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->cursorDigitStepping;
+}
+
+void QInt32SpinBox::setCursorDigitStepping(bool enable)
+{
+    Q_D(QInt32SpinBox);
+    d->cursorDigitStepping = enable;
+}
+
+bool QInt32SpinBox::isChromeCached() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->chromeCached;
+}
+
+void QInt32SpinBox::setChromeCached(bool enable)
+{
+    Q_D(QInt32SpinBox);
+    d->setChromeCached(enable);
+}
+
+bool QInt32SpinBox::isGlyphCached() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->glyphCached;
+}
+
+void QInt32SpinBox::setGlyphCached(bool enable)
+{
+    Q_D(QInt32SpinBox);
+    d->setGlyphCached(enable);
+}
+
+bool QInt32SpinBox::isFramePaced() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->framePaced;
+}
+
+void QInt32SpinBox::setFramePaced(bool enable)
+{
+    Q_D(QInt32SpinBox);
+    d->setFramePaced(enable);
+}
+
+AccelerationCurve QInt32SpinBox::accelerationCurve() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->accelerationCurve;
+}
+
+void QInt32SpinBox::setAccelerationCurve(AccelerationCurve curve)
+{
+    Q_D(QInt32SpinBox);
+    d->accelerationCurve = curve;
+}
+
+void QInt32SpinBox::setAccelerationFunction(const AccelerationFunction &function)
+{
+    Q_D(QInt32SpinBox);
+    d->setAccelerationFunction(function);
+}
+
+WheelMode QInt32SpinBox::wheelMode() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->wheelMode;
+}
+
+void QInt32SpinBox::setWheelMode(WheelMode mode)
+{
+    Q_D(QInt32SpinBox);
+    d->wheelMode = mode;
+}
+
+bool QInt32SpinBox::isScrubEnabled() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->scrubEnabled;
+}
+
+void QInt32SpinBox::setScrubEnabled(bool enable)
+{
+    Q_D(QInt32SpinBox);
+    d->scrubEnabled = enable;
+}
+
+AccelerationCurve QInt32SpinBox::scrubCurve() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->scrubCurve;
+}
+
+void QInt32SpinBox::setScrubCurve(AccelerationCurve curve)
+{
+    Q_D(QInt32SpinBox);
+    d->scrubCurve = curve;
+}
+
+void QInt32SpinBox::setScrubFunction(const ScrubFunction &function)
+{
+    Q_D(QInt32SpinBox);
+    d->setScrubFunction(function);
+}
+
+int QInt32SpinBox::keyboardTrackingDelay() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->keyboardTrackingDelay;
+}
+
+void QInt32SpinBox::setKeyboardTrackingDelay(int msec)
+{
+    Q_D(QInt32SpinBox);
+    d->setKeyboardTrackingDelay(msec);
+}
+
+int QInt32SpinBox::emissionInterval() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->emissionInterval;
+}
+
+void QInt32SpinBox::setEmissionInterval(int msec)
+{
+    Q_D(QInt32SpinBox);
+    d->setEmissionInterval(msec);
+}
+
+bool QInt32SpinBox::isInteracting() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->interacting;
+}
+
+QInt32SpinBox::Type QInt32SpinBox::deadband() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->deadband;
+}
+
+void QInt32SpinBox::setDeadband(Type delta)
+{
+    Q_D(QInt32SpinBox);
+    d->setDeadband(delta);
+}
+
 void QInt32SpinBox::fixup(QString &input) const
 {
     Q_D(const QInt32SpinBox);
@@ -181,6 +400,24 @@ void QInt32SpinBox::stepBy(int steps)
     d->stepBy(steps);
 }
 
+void QInt32SpinBox::stepUpBy(Type count)
+{
+    Q_D(QInt32SpinBox);
+    d->stepByWide(count, true);
+}
+
+void QInt32SpinBox::stepDownBy(Type count)
+{
+    Q_D(QInt32SpinBox);
+    d->stepByWide(count, false);
+}
+
+void QInt32SpinBox::stepTo(Type target)
+{
+    Q_D(QInt32SpinBox);
+    d->stepTo(target);
+}
+
 QValidator::State QInt32SpinBox::validate(QString &input, int &pos) const
 {
     Q_D(const QInt32SpinBox);
@@ -203,6 +440,12 @@ QInt32SpinBox::Type QInt32SpinBox::value() const
     return d->value;
 }
 
+QString QInt32SpinBox::valueText() const
+{
+    Q_D(const QInt32SpinBox);
+    return d->displayText();
+}
+
 QSize QInt32SpinBox::minimumSizeHint() const
 {
     Q_D(const QInt32SpinBox);
@@ -319,6 +562,14 @@ void QInt32SpinBox::mouseReleaseEvent(QMouseEvent *event)
     d->mouseReleaseEvent(event);
 }
 
+void QInt32SpinBox::paintEvent(QPaintEvent *event)
+{
+    Q_D(QInt32SpinBox);
+    if (!d->paintEvent(event)) {
+        QAbstractSpinBox::paintEvent(event);
+    }
+}
+
 void QInt32SpinBox::resizeEvent(QResizeEvent *event)
 {
     QWidget::resizeEvent(event);
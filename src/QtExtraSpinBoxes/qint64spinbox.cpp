@@ -57,8 +57,17 @@ protected:
     void emitSignalsImpl() override
     {
         Q_Q(QInt64SpinBox);
-        Q_EMIT q->textChanged(q_edit()->displayText());
+        if (q->isSignalConnected(QMetaMethod::fromSignal(&QInt64SpinBox::textChanged))) {
+            Q_EMIT q->textChanged(displayText());
+        }
         Q_EMIT q->valueChanged(value);
+        Q_EMIT q->valueChangedDetailed(lastEmittedValue, value, changeSource, interacting);
+    }
+
+    void emitFinishedImpl() override
+    {
+        Q_Q(QInt64SpinBox);
+        Q_EMIT q->valueChangedDetailed(value, value, changeSource, false);
     }
 };
 
@@ -108,6 +117,18 @@ void QInt64SpinBox::setRange(Type minimum, Type maximum)
     d->setRange(minimum, maximum);
 }
 
+QList<QInt64SpinBox::Type> QInt64SpinBox::allowedValues() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->allowedValues;
+}
+
+void QInt64SpinBox::setAllowedValues(const QList<Type> &values)
+{
+    Q_D(QInt64SpinBox);
+    d->setAllowedValues(values);
+}
+
 QInt64SpinBox::Type QInt64SpinBox::singleStep() const
 {
     Q_D(const QInt64SpinBox);
@@ -168,6 +189,204 @@ void QInt64SpinBox::setStepType(StepType stepType)
     d->stepType = stepType;
 }
 
+int QInt64SpinBox::adaptiveSignificantDigits() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->adaptiveSignificantDigits;
+}
+
+void QInt64SpinBox::setAdaptiveSignificantDigits(int digits)
+{
+    Q_D(QInt64SpinBox);
+    d->setAdaptiveSignificantDigits(digits);
+}
+
+StepMode QInt64SpinBox::stepMode() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->stepMode;
+}
+
+void QInt64SpinBox::setStepMode(StepMode mode)
+{
+    Q_D(QInt64SpinBox);
+    d->stepMode = mode;
+}
+
+QInt64SpinBox::Type QInt64SpinBox::stepFactor() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->stepFactor;
+}
+
+void QInt64SpinBox::setStepFactor(Type factor)
+{
+    Q_D(QInt64SpinBox);
+    d->setStepFactor(factor);
+}
+
+OverflowPolicy QInt64SpinBox::overflowPolicy() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->overflowPolicy;
+}
+
+void QInt64SpinBox::setOverflowPolicy(OverflowPolicy policy)
+{
+    Q_D(QInt64SpinBox);
+    d->overflowPolicy = policy;
+}
+
+bool QInt64SpinBox::isCursorDigitStepping() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->cursorDigitStepping;
+}
+
+void QInt64SpinBox::setCursorDigitStepping(bool enable)
+{
+    Q_D(QInt64SpinBox);
+    d->cursorDigitStepping = enable;
+}
+
+bool QInt64SpinBox::isChromeCached() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->chromeCached;
+}
+
+void QInt64SpinBox::setChromeCached(bool enable)
+{
+    Q_D(QInt64SpinBox);
+    d->setChromeCached(enable);
+}
+
+bool QInt64SpinBox::isGlyphCached() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->glyphCached;
+}
+
+void QInt64SpinBox::setGlyphCached(bool enable)
+{
+    Q_D(QInt64SpinBox);
+    d->setGlyphCached(enable);
+}
+
+bool QInt64SpinBox::isFramePaced() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->framePaced;
+}
+
+void QInt64SpinBox::setFramePaced(bool enable)
+{
+    Q_D(QInt64SpinBox);
+    d->setFramePaced(enable);
+}
+
+AccelerationCurve QInt64SpinBox::accelerationCurve() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->accelerationCurve;
+}
+
+void QInt64SpinBox::setAccelerationCurve(AccelerationCurve curve)
+{
+    Q_D(QInt64SpinBox);
+    d->accelerationCurve = curve;
+}
+
+void QInt64SpinBox::setAccelerationFunction(const AccelerationFunction &function)
+{
+    Q_D(QInt64SpinBox);
+    d->setAccelerationFunction(function);
+}
+
+WheelMode QInt64SpinBox::wheelMode() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->wheelMode;
+}
+
+void QInt64SpinBox::setWheelMode(WheelMode mode)
+{
+    Q_D(QInt64SpinBox);
+    d->wheelMode = mode;
+}
+
+bool QInt64SpinBox::isScrubEnabled() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->scrubEnabled;
+}
+
+void QInt64SpinBox::setScrubEnabled(bool enable)
+{
+    Q_D(QInt64SpinBox);
+    d->scrubEnabled = enable;
+}
+
+AccelerationCurve QInt64SpinBox::scrubCurve() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->scrubCurve;
+}
+
+void QInt64SpinBox::setScrubCurve(AccelerationCurve curve)
+{
+    Q_D(QInt64SpinBox);
+    d->scrubCurve = curve;
+}
+
+void QInt64SpinBox::setScrubFunction(const ScrubFunction &function)
+{
+    Q_D(QInt64SpinBox);
+    d->setScrubFunction(function);
+}
+
+int QInt64SpinBox::keyboardTrackingDelay() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->keyboardTrackingDelay;
+}
+
+void QInt64SpinBox::setKeyboardTrackingDelay(int msec)
+{
+    Q_D(QInt64SpinBox);
+    d->setKeyboardTrackingDelay(msec);
+}
+
+int QInt64SpinBox::emissionInterval() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->emissionInterval;
+}
+
+void QInt64SpinBox::setEmissionInterval(int msec)
+{
+    Q_D(QInt64SpinBox);
+    d->setEmissionInterval(msec);
+}
+
+bool QInt64SpinBox::isInteracting() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->interacting;
+}
+
+QInt64SpinBox::Type QInt64SpinBox::deadband() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->deadband;
+}
+
+void QInt64SpinBox::setDeadband(Type delta)
+{
+    Q_D(QInt64SpinBox);
+    d->setDeadband(delta);
+}
+
 void QInt64SpinBox::fixup(QString &input) const
 {
     Q_D(const QInt64SpinBox);
@@ -180,6 +399,24 @@ void QInt64SpinBox::stepBy(int steps)
     d->stepBy(steps);
 }
 
+void QInt64SpinBox::stepUpBy(Type count)
+{
+    Q_D(QInt64SpinBox);
+    d->stepByWide(count, true);
+}
+
+void QInt64SpinBox::stepDownBy(Type count)
+{
+    Q_D(QInt64SpinBox);
+    d->stepByWide(count, false);
+}
+
+void QInt64SpinBox::stepTo(Type target)
+{
+    Q_D(QInt64SpinBox);
+    d->stepTo(target);
+}
+
 QValidator::State QInt64SpinBox::validate(QString &input, int &pos) const
 {
     Q_D(const QInt64SpinBox);
@@ -202,6 +439,12 @@ QInt64SpinBox::Type QInt64SpinBox::value() const
     return d->value;
 }
 
+QString QInt64SpinBox::valueText() const
+{
+    Q_D(const QInt64SpinBox);
+    return d->displayText();
+}
+
 QSize QInt64SpinBox::minimumSizeHint() const
 {
     Q_D(const QInt64SpinBox);
@@ -318,6 +561,14 @@ void QInt64SpinBox::mouseReleaseEvent(QMouseEvent *event)
     d->mouseReleaseEvent(event);
 }
 
+void QInt64SpinBox::paintEvent(QPaintEvent *event)
+{
+    Q_D(QInt64SpinBox);
+    if (!d->paintEvent(event)) {
+        QAbstractSpinBox::paintEvent(event);
+    }
+}
+
 void QInt64SpinBox::resizeEvent(QResizeEvent *event)
 {
     QWidget::resizeEvent(event);
@@ -336,7 +587,7 @@ void QInt64SpinBox::timerEvent(QTimerEvent *event)
 {
     Q_D(QInt64SpinBox);
     d->timerEvent(event);
-    QWidget::changeEvent(event);
+    QWidget::timerEvent(event);
 }
 
 #if QT_CONFIG(wheelevent)
@@ -0,0 +1,607 @@
+// SPDX-FileCopyrightText: 2025 Trần Nam Tuấn <tuantran1632001@gmail.com>
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include "QtExtraSpinBoxes/qufixedpoint64spinbox.hpp"
+
+#include "QtExtraSpinBoxes/private/qextraspinbox_p.hpp"
+
+namespace QtExtraSpinBoxes
+{
+class QUFixedPoint64SpinBoxPrivate : public QExtraSpinBoxPrivate<QUFixedPoint64SpinBox::Type>
+{
+    Q_DISABLE_COPY(QUFixedPoint64SpinBoxPrivate)
+    Q_DECLARE_PUBLIC(QUFixedPoint64SpinBox)
+public:
+    explicit QUFixedPoint64SpinBoxPrivate(QUFixedPoint64SpinBox *qq)
+        : QExtraSpinBoxPrivate{qq}
+    {
+    }
+
+protected:
+    QLineEdit *q_edit() const override
+    {
+        Q_Q(const QUFixedPoint64SpinBox);
+        return q->lineEdit();
+    }
+
+    void q_initStyleOption(QStyleOptionSpinBox *option) const override
+    {
+        Q_Q(const QUFixedPoint64SpinBox);
+        return q->initStyleOption(option);
+    }
+
+    QAbstractSpinBox::StepEnabled q_stepEnabled() const override
+    {
+        Q_Q(const QUFixedPoint64SpinBox);
+        return q->stepEnabled();
+    }
+
+    QValidator::State q_validate(QString &input, int &pos) const override
+    {
+        Q_Q(const QUFixedPoint64SpinBox);
+        return q->validate(input, pos);
+    }
+
+    QString textFromValue(QUFixedPoint64SpinBox::Type value) const override
+    {
+        Q_Q(const QUFixedPoint64SpinBox);
+        return q->textFromValue(value);
+    }
+
+    QUFixedPoint64SpinBox::Type valueFromText(const QString &text) const override
+    {
+        Q_Q(const QUFixedPoint64SpinBox);
+        return q->valueFromText(text);
+    }
+
+    void emitSignalsImpl() override
+    {
+        Q_Q(QUFixedPoint64SpinBox);
+        if (q->isSignalConnected(QMetaMethod::fromSignal(&QUFixedPoint64SpinBox::textChanged))) {
+            Q_EMIT q->textChanged(displayText());
+        }
+        Q_EMIT q->valueChanged(value);
+        Q_EMIT q->valueChangedDetailed(lastEmittedValue, value, changeSource, interacting);
+    }
+
+    void emitFinishedImpl() override
+    {
+        Q_Q(QUFixedPoint64SpinBox);
+        Q_EMIT q->valueChangedDetailed(value, value, changeSource, false);
+    }
+};
+
+QUFixedPoint64SpinBox::QUFixedPoint64SpinBox(int decimals, QWidget *parent)
+    : QAbstractSpinBox{parent}
+    , d_ptr{new QUFixedPoint64SpinBoxPrivate(this)}
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->init();
+    d->setDecimals(decimals);
+}
+
+QUFixedPoint64SpinBox::~QUFixedPoint64SpinBox() = default;
+
+QString QUFixedPoint64SpinBox::cleanText() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->cleanText();
+}
+
+QUFixedPoint64SpinBox::Type QUFixedPoint64SpinBox::minimum() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->minimum;
+}
+
+void QUFixedPoint64SpinBox::setMinimum(Type minimum)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setMinimum(minimum);
+}
+
+QUFixedPoint64SpinBox::Type QUFixedPoint64SpinBox::maximum() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->maximum;
+}
+
+void QUFixedPoint64SpinBox::setMaximum(Type maximum)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setMaximum(maximum);
+}
+
+void QUFixedPoint64SpinBox::setRange(Type minimum, Type maximum)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setRange(minimum, maximum);
+}
+
+QList<QUFixedPoint64SpinBox::Type> QUFixedPoint64SpinBox::allowedValues() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->allowedValues;
+}
+
+void QUFixedPoint64SpinBox::setAllowedValues(const QList<Type> &values)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setAllowedValues(values);
+}
+
+QUFixedPoint64SpinBox::Type QUFixedPoint64SpinBox::singleStep() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->singleStep;
+}
+
+void QUFixedPoint64SpinBox::setSingleStep(Type value)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setSingleStep(value);
+}
+
+int QUFixedPoint64SpinBox::displayIntegerBase() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->displayIntegerBase;
+}
+
+void QUFixedPoint64SpinBox::setDisplayIntegerBase(int base)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setDisplayIntegerBase(base);
+}
+
+int QUFixedPoint64SpinBox::decimals() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->decimals;
+}
+
+QString QUFixedPoint64SpinBox::prefix() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->prefix;
+}
+
+void QUFixedPoint64SpinBox::setPrefix(const QString &prefix)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setPrefix(prefix);
+}
+
+QString QUFixedPoint64SpinBox::suffix() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->suffix;
+}
+
+void QUFixedPoint64SpinBox::setSuffix(const QString &suffix)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setSuffix(suffix);
+}
+
+QAbstractSpinBox::StepType QUFixedPoint64SpinBox::stepType() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->stepType;
+}
+
+void QUFixedPoint64SpinBox::setStepType(StepType stepType)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->stepType = stepType;
+}
+
+int QUFixedPoint64SpinBox::adaptiveSignificantDigits() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->adaptiveSignificantDigits;
+}
+
+void QUFixedPoint64SpinBox::setAdaptiveSignificantDigits(int digits)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setAdaptiveSignificantDigits(digits);
+}
+
+StepMode QUFixedPoint64SpinBox::stepMode() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->stepMode;
+}
+
+void QUFixedPoint64SpinBox::setStepMode(StepMode mode)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->stepMode = mode;
+}
+
+QUFixedPoint64SpinBox::Type QUFixedPoint64SpinBox::stepFactor() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->stepFactor;
+}
+
+void QUFixedPoint64SpinBox::setStepFactor(Type factor)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setStepFactor(factor);
+}
+
+OverflowPolicy QUFixedPoint64SpinBox::overflowPolicy() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->overflowPolicy;
+}
+
+void QUFixedPoint64SpinBox::setOverflowPolicy(OverflowPolicy policy)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->overflowPolicy = policy;
+}
+
+bool QUFixedPoint64SpinBox::isCursorDigitStepping() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->cursorDigitStepping;
+}
+
+void QUFixedPoint64SpinBox::setCursorDigitStepping(bool enable)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->cursorDigitStepping = enable;
+}
+
+bool QUFixedPoint64SpinBox::isChromeCached() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->chromeCached;
+}
+
+void QUFixedPoint64SpinBox::setChromeCached(bool enable)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setChromeCached(enable);
+}
+
+bool QUFixedPoint64SpinBox::isGlyphCached() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->glyphCached;
+}
+
+void QUFixedPoint64SpinBox::setGlyphCached(bool enable)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setGlyphCached(enable);
+}
+
+bool QUFixedPoint64SpinBox::isFramePaced() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->framePaced;
+}
+
+void QUFixedPoint64SpinBox::setFramePaced(bool enable)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setFramePaced(enable);
+}
+
+AccelerationCurve QUFixedPoint64SpinBox::accelerationCurve() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->accelerationCurve;
+}
+
+void QUFixedPoint64SpinBox::setAccelerationCurve(AccelerationCurve curve)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->accelerationCurve = curve;
+}
+
+void QUFixedPoint64SpinBox::setAccelerationFunction(const AccelerationFunction &function)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setAccelerationFunction(function);
+}
+
+WheelMode QUFixedPoint64SpinBox::wheelMode() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->wheelMode;
+}
+
+void QUFixedPoint64SpinBox::setWheelMode(WheelMode mode)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->wheelMode = mode;
+}
+
+bool QUFixedPoint64SpinBox::isScrubEnabled() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->scrubEnabled;
+}
+
+void QUFixedPoint64SpinBox::setScrubEnabled(bool enable)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->scrubEnabled = enable;
+}
+
+AccelerationCurve QUFixedPoint64SpinBox::scrubCurve() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->scrubCurve;
+}
+
+void QUFixedPoint64SpinBox::setScrubCurve(AccelerationCurve curve)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->scrubCurve = curve;
+}
+
+void QUFixedPoint64SpinBox::setScrubFunction(const ScrubFunction &function)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setScrubFunction(function);
+}
+
+int QUFixedPoint64SpinBox::keyboardTrackingDelay() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->keyboardTrackingDelay;
+}
+
+void QUFixedPoint64SpinBox::setKeyboardTrackingDelay(int msec)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setKeyboardTrackingDelay(msec);
+}
+
+int QUFixedPoint64SpinBox::emissionInterval() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->emissionInterval;
+}
+
+void QUFixedPoint64SpinBox::setEmissionInterval(int msec)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setEmissionInterval(msec);
+}
+
+bool QUFixedPoint64SpinBox::isInteracting() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->interacting;
+}
+
+QUFixedPoint64SpinBox::Type QUFixedPoint64SpinBox::deadband() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->deadband;
+}
+
+void QUFixedPoint64SpinBox::setDeadband(Type delta)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setDeadband(delta);
+}
+
+void QUFixedPoint64SpinBox::fixup(QString &input) const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    d->fixup(input);
+}
+
+void QUFixedPoint64SpinBox::stepBy(int steps)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->stepBy(steps);
+}
+
+void QUFixedPoint64SpinBox::stepUpBy(Type count)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->stepByWide(count, true);
+}
+
+void QUFixedPoint64SpinBox::stepDownBy(Type count)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->stepByWide(count, false);
+}
+
+void QUFixedPoint64SpinBox::stepTo(Type target)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->stepTo(target);
+}
+
+QValidator::State QUFixedPoint64SpinBox::validate(QString &input, int &pos) const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->validateImpl(input, pos);
+}
+
+bool QUFixedPoint64SpinBox::event(QEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    auto ret = d->event(event);
+    if (ret.has_value()) {
+        return ret.value();
+    }
+    return QWidget::event(event);
+}
+
+QUFixedPoint64SpinBox::Type QUFixedPoint64SpinBox::value() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->value;
+}
+
+QString QUFixedPoint64SpinBox::valueText() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->displayText();
+}
+
+QSize QUFixedPoint64SpinBox::minimumSizeHint() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->minimumSizeHint();
+}
+
+QSize QUFixedPoint64SpinBox::sizeHint() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->sizeHint();
+}
+
+void QUFixedPoint64SpinBox::clear()
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->clear();
+}
+
+void QUFixedPoint64SpinBox::setValue(Type value)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->setValue(value, EmitIfChanged);
+}
+
+QString QUFixedPoint64SpinBox::textFromValue(Type value) const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->textFromValueImpl(value);
+}
+
+void QUFixedPoint64SpinBox::initStyleOption(QStyleOptionSpinBox *option) const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->initStyleOptionImpl(option);
+}
+
+QAbstractSpinBox::StepEnabled QUFixedPoint64SpinBox::stepEnabled() const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->stepEnabledImpl();
+}
+
+QUFixedPoint64SpinBox::Type QUFixedPoint64SpinBox::valueFromText(const QString &text) const
+{
+    Q_D(const QUFixedPoint64SpinBox);
+    return d->valueFromTextImpl(text);
+}
+
+void QUFixedPoint64SpinBox::changeEvent(QEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->changeEvent(event);
+    QWidget::changeEvent(event);
+}
+
+void QUFixedPoint64SpinBox::closeEvent(QCloseEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->closeEvent(event);
+    QWidget::closeEvent(event);
+}
+
+#if QT_CONFIG(contextmenu)
+void QUFixedPoint64SpinBox::contextMenuEvent(QContextMenuEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->contextMenuEvent(event);
+    QWidget::contextMenuEvent(event);
+}
+#endif // QT_CONFIG(contextmenu)
+
+void QUFixedPoint64SpinBox::focusOutEvent(QFocusEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->focusOutEvent(event);
+    QWidget::focusOutEvent(event);
+    Q_EMIT editingFinished();
+}
+
+void QUFixedPoint64SpinBox::hideEvent(QHideEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->hideEvent(event);
+    QWidget::hideEvent(event);
+}
+
+void QUFixedPoint64SpinBox::keyPressEvent(QKeyEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->keyPressEvent(event);
+}
+
+void QUFixedPoint64SpinBox::keyReleaseEvent(QKeyEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->keyReleaseEvent(event);
+}
+
+void QUFixedPoint64SpinBox::mouseMoveEvent(QMouseEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->mouseMoveEvent(event);
+}
+
+void QUFixedPoint64SpinBox::mousePressEvent(QMouseEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->mousePressEvent(event);
+}
+
+void QUFixedPoint64SpinBox::mouseReleaseEvent(QMouseEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->mouseReleaseEvent(event);
+}
+
+void QUFixedPoint64SpinBox::paintEvent(QPaintEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    if (!d->paintEvent(event)) {
+        QAbstractSpinBox::paintEvent(event);
+    }
+}
+
+void QUFixedPoint64SpinBox::resizeEvent(QResizeEvent *event)
+{
+    QWidget::resizeEvent(event);
+
+    Q_D(QUFixedPoint64SpinBox);
+    d->resizeEvent(event);
+}
+
+void QUFixedPoint64SpinBox::showEvent(QShowEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->showEvent(event);
+}
+
+void QUFixedPoint64SpinBox::timerEvent(QTimerEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->timerEvent(event);
+    QWidget::timerEvent(event);
+}
+
+#if QT_CONFIG(wheelevent)
+void QUFixedPoint64SpinBox::wheelEvent(QWheelEvent *event)
+{
+    Q_D(QUFixedPoint64SpinBox);
+    d->wheelEvent(event);
+}
+#endif // QT_CONFIG(wheelevent)
+} // namespace QtExtraSpinBoxes
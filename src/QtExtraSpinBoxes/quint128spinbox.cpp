@@ -0,0 +1,602 @@
+// SPDX-FileCopyrightText: 2025 Trần Nam Tuấn <tuantran1632001@gmail.com>
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include "QtExtraSpinBoxes/quint128spinbox.hpp"
+
+#ifdef QT_SUPPORTS_INT128
+#include "QtExtraSpinBoxes/private/qextraspinbox_p.hpp"
+
+namespace QtExtraSpinBoxes
+{
+class QUInt128SpinBoxPrivate : public QExtraSpinBoxPrivate<QUInt128SpinBox::Type>
+{
+    Q_DISABLE_COPY(QUInt128SpinBoxPrivate)
+    Q_DECLARE_PUBLIC(QUInt128SpinBox)
+public:
+    explicit QUInt128SpinBoxPrivate(QUInt128SpinBox *qq)
+        : QExtraSpinBoxPrivate{qq}
+    {
+    }
+
+protected:
+    QLineEdit *q_edit() const override
+    {
+        Q_Q(const QUInt128SpinBox);
+        return q->lineEdit();
+    }
+
+    void q_initStyleOption(QStyleOptionSpinBox *option) const override
+    {
+        Q_Q(const QUInt128SpinBox);
+        return q->initStyleOption(option);
+    }
+
+    QAbstractSpinBox::StepEnabled q_stepEnabled() const override
+    {
+        Q_Q(const QUInt128SpinBox);
+        return q->stepEnabled();
+    }
+
+    QValidator::State q_validate(QString &input, int &pos) const override
+    {
+        Q_Q(const QUInt128SpinBox);
+        return q->validate(input, pos);
+    }
+
+    QString textFromValue(QUInt128SpinBox::Type value) const override
+    {
+        Q_Q(const QUInt128SpinBox);
+        return q->textFromValue(value);
+    }
+
+    QUInt128SpinBox::Type valueFromText(const QString &text) const override
+    {
+        Q_Q(const QUInt128SpinBox);
+        return q->valueFromText(text);
+    }
+
+    void emitSignalsImpl() override
+    {
+        Q_Q(QUInt128SpinBox);
+        if (q->isSignalConnected(QMetaMethod::fromSignal(&QUInt128SpinBox::textChanged))) {
+            Q_EMIT q->textChanged(displayText());
+        }
+        Q_EMIT q->valueChanged(value);
+        Q_EMIT q->valueChangedDetailed(lastEmittedValue, value, changeSource, interacting);
+    }
+
+    void emitFinishedImpl() override
+    {
+        Q_Q(QUInt128SpinBox);
+        Q_EMIT q->valueChangedDetailed(value, value, changeSource, false);
+    }
+};
+
+QUInt128SpinBox::QUInt128SpinBox(QWidget *parent)
+    : QAbstractSpinBox{parent}
+    , d_ptr{new QUInt128SpinBoxPrivate(this)}
+{
+    Q_D(QUInt128SpinBox);
+    d->init();
+}
+
+QUInt128SpinBox::~QUInt128SpinBox() = default;
+
+QString QUInt128SpinBox::cleanText() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->cleanText();
+}
+
+QUInt128SpinBox::Type QUInt128SpinBox::minimum() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->minimum;
+}
+
+void QUInt128SpinBox::setMinimum(Type minimum)
+{
+    Q_D(QUInt128SpinBox);
+    d->setMinimum(minimum);
+}
+
+QUInt128SpinBox::Type QUInt128SpinBox::maximum() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->maximum;
+}
+
+void QUInt128SpinBox::setMaximum(Type maximum)
+{
+    Q_D(QUInt128SpinBox);
+    d->setMaximum(maximum);
+}
+
+void QUInt128SpinBox::setRange(Type minimum, Type maximum)
+{
+    Q_D(QUInt128SpinBox);
+    d->setRange(minimum, maximum);
+}
+
+QList<QUInt128SpinBox::Type> QUInt128SpinBox::allowedValues() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->allowedValues;
+}
+
+void QUInt128SpinBox::setAllowedValues(const QList<Type> &values)
+{
+    Q_D(QUInt128SpinBox);
+    d->setAllowedValues(values);
+}
+
+QUInt128SpinBox::Type QUInt128SpinBox::singleStep() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->singleStep;
+}
+
+void QUInt128SpinBox::setSingleStep(Type value)
+{
+    Q_D(QUInt128SpinBox);
+    d->setSingleStep(value);
+}
+
+int QUInt128SpinBox::displayIntegerBase() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->displayIntegerBase;
+}
+
+void QUInt128SpinBox::setDisplayIntegerBase(int base)
+{
+    Q_D(QUInt128SpinBox);
+    d->setDisplayIntegerBase(base);
+}
+
+QString QUInt128SpinBox::prefix() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->prefix;
+}
+
+void QUInt128SpinBox::setPrefix(const QString &prefix)
+{
+    Q_D(QUInt128SpinBox);
+    d->setPrefix(prefix);
+}
+
+QString QUInt128SpinBox::suffix() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->suffix;
+}
+
+void QUInt128SpinBox::setSuffix(const QString &suffix)
+{
+    Q_D(QUInt128SpinBox);
+    d->setSuffix(suffix);
+}
+
+QAbstractSpinBox::StepType QUInt128SpinBox::stepType() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->stepType;
+}
+
+void QUInt128SpinBox::setStepType(StepType stepType)
+{
+    Q_D(QUInt128SpinBox);
+    d->stepType = stepType;
+}
+
+int QUInt128SpinBox::adaptiveSignificantDigits() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->adaptiveSignificantDigits;
+}
+
+void QUInt128SpinBox::setAdaptiveSignificantDigits(int digits)
+{
+    Q_D(QUInt128SpinBox);
+    d->setAdaptiveSignificantDigits(digits);
+}
+
+StepMode QUInt128SpinBox::stepMode() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->stepMode;
+}
+
+void QUInt128SpinBox::setStepMode(StepMode mode)
+{
+    Q_D(QUInt128SpinBox);
+    d->stepMode = mode;
+}
+
+QUInt128SpinBox::Type QUInt128SpinBox::stepFactor() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->stepFactor;
+}
+
+void QUInt128SpinBox::setStepFactor(Type factor)
+{
+    Q_D(QUInt128SpinBox);
+    d->setStepFactor(factor);
+}
+
+OverflowPolicy QUInt128SpinBox::overflowPolicy() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->overflowPolicy;
+}
+
+void QUInt128SpinBox::setOverflowPolicy(OverflowPolicy policy)
+{
+    Q_D(QUInt128SpinBox);
+    d->overflowPolicy = policy;
+}
+
+bool QUInt128SpinBox::isCursorDigitStepping() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->cursorDigitStepping;
+}
+
+void QUInt128SpinBox::setCursorDigitStepping(bool enable)
+{
+    Q_D(QUInt128SpinBox);
+    d->cursorDigitStepping = enable;
+}
+
+bool QUInt128SpinBox::isChromeCached() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->chromeCached;
+}
+
+void QUInt128SpinBox::setChromeCached(bool enable)
+{
+    Q_D(QUInt128SpinBox);
+    d->setChromeCached(enable);
+}
+
+bool QUInt128SpinBox::isGlyphCached() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->glyphCached;
+}
+
+void QUInt128SpinBox::setGlyphCached(bool enable)
+{
+    Q_D(QUInt128SpinBox);
+    d->setGlyphCached(enable);
+}
+
+bool QUInt128SpinBox::isFramePaced() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->framePaced;
+}
+
+void QUInt128SpinBox::setFramePaced(bool enable)
+{
+    Q_D(QUInt128SpinBox);
+    d->setFramePaced(enable);
+}
+
+AccelerationCurve QUInt128SpinBox::accelerationCurve() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->accelerationCurve;
+}
+
+void QUInt128SpinBox::setAccelerationCurve(AccelerationCurve curve)
+{
+    Q_D(QUInt128SpinBox);
+    d->accelerationCurve = curve;
+}
+
+void QUInt128SpinBox::setAccelerationFunction(const AccelerationFunction &function)
+{
+    Q_D(QUInt128SpinBox);
+    d->setAccelerationFunction(function);
+}
+
+WheelMode QUInt128SpinBox::wheelMode() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->wheelMode;
+}
+
+void QUInt128SpinBox::setWheelMode(WheelMode mode)
+{
+    Q_D(QUInt128SpinBox);
+    d->wheelMode = mode;
+}
+
+bool QUInt128SpinBox::isScrubEnabled() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->scrubEnabled;
+}
+
+void QUInt128SpinBox::setScrubEnabled(bool enable)
+{
+    Q_D(QUInt128SpinBox);
+    d->scrubEnabled = enable;
+}
+
+AccelerationCurve QUInt128SpinBox::scrubCurve() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->scrubCurve;
+}
+
+void QUInt128SpinBox::setScrubCurve(AccelerationCurve curve)
+{
+    Q_D(QUInt128SpinBox);
+    d->scrubCurve = curve;
+}
+
+void QUInt128SpinBox::setScrubFunction(const ScrubFunction &function)
+{
+    Q_D(QUInt128SpinBox);
+    d->setScrubFunction(function);
+}
+
+int QUInt128SpinBox::keyboardTrackingDelay() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->keyboardTrackingDelay;
+}
+
+void QUInt128SpinBox::setKeyboardTrackingDelay(int msec)
+{
+    Q_D(QUInt128SpinBox);
+    d->setKeyboardTrackingDelay(msec);
+}
+
+int QUInt128SpinBox::emissionInterval() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->emissionInterval;
+}
+
+void QUInt128SpinBox::setEmissionInterval(int msec)
+{
+    Q_D(QUInt128SpinBox);
+    d->setEmissionInterval(msec);
+}
+
+bool QUInt128SpinBox::isInteracting() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->interacting;
+}
+
+QUInt128SpinBox::Type QUInt128SpinBox::deadband() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->deadband;
+}
+
+void QUInt128SpinBox::setDeadband(Type delta)
+{
+    Q_D(QUInt128SpinBox);
+    d->setDeadband(delta);
+}
+
+void QUInt128SpinBox::fixup(QString &input) const
+{
+    Q_D(const QUInt128SpinBox);
+    d->fixup(input);
+}
+
+void QUInt128SpinBox::stepBy(int steps)
+{
+    Q_D(QUInt128SpinBox);
+    d->stepBy(steps);
+}
+
+void QUInt128SpinBox::stepUpBy(Type count)
+{
+    Q_D(QUInt128SpinBox);
+    d->stepByWide(count, true);
+}
+
+void QUInt128SpinBox::stepDownBy(Type count)
+{
+    Q_D(QUInt128SpinBox);
+    d->stepByWide(count, false);
+}
+
+void QUInt128SpinBox::stepTo(Type target)
+{
+    Q_D(QUInt128SpinBox);
+    d->stepTo(target);
+}
+
+QValidator::State QUInt128SpinBox::validate(QString &input, int &pos) const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->validateImpl(input, pos);
+}
+
+bool QUInt128SpinBox::event(QEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    auto ret = d->event(event);
+    if (ret.has_value()) {
+        return ret.value();
+    }
+    return QWidget::event(event);
+}
+
+QUInt128SpinBox::Type QUInt128SpinBox::value() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->value;
+}
+
+QString QUInt128SpinBox::valueText() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->displayText();
+}
+
+QSize QUInt128SpinBox::minimumSizeHint() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->minimumSizeHint();
+}
+
+QSize QUInt128SpinBox::sizeHint() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->sizeHint();
+}
+
+void QUInt128SpinBox::clear()
+{
+    Q_D(QUInt128SpinBox);
+    d->clear();
+}
+
+void QUInt128SpinBox::setValue(Type value)
+{
+    Q_D(QUInt128SpinBox);
+    d->setValue(value, EmitIfChanged);
+}
+
+QString QUInt128SpinBox::textFromValue(Type value) const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->textFromValueImpl(value);
+}
+
+void QUInt128SpinBox::initStyleOption(QStyleOptionSpinBox *option) const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->initStyleOptionImpl(option);
+}
+
+QAbstractSpinBox::StepEnabled QUInt128SpinBox::stepEnabled() const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->stepEnabledImpl();
+}
+
+QUInt128SpinBox::Type QUInt128SpinBox::valueFromText(const QString &text) const
+{
+    Q_D(const QUInt128SpinBox);
+    return d->valueFromTextImpl(text);
+}
+
+void QUInt128SpinBox::changeEvent(QEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    d->changeEvent(event);
+    QWidget::changeEvent(event);
+}
+
+void QUInt128SpinBox::closeEvent(QCloseEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    d->closeEvent(event);
+    QWidget::closeEvent(event);
+}
+
+#if QT_CONFIG(contextmenu)
+void QUInt128SpinBox::contextMenuEvent(QContextMenuEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    d->contextMenuEvent(event);
+    QWidget::contextMenuEvent(event);
+}
+#endif // QT_CONFIG(contextmenu)
+
+void QUInt128SpinBox::focusOutEvent(QFocusEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    d->focusOutEvent(event);
+    QWidget::focusOutEvent(event);
+    Q_EMIT editingFinished();
+}
+
+void QUInt128SpinBox::hideEvent(QHideEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    d->hideEvent(event);
+    QWidget::hideEvent(event);
+}
+
+void QUInt128SpinBox::keyPressEvent(QKeyEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    d->keyPressEvent(event);
+}
+
+void QUInt128SpinBox::keyReleaseEvent(QKeyEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    d->keyReleaseEvent(event);
+}
+
+void QUInt128SpinBox::mouseMoveEvent(QMouseEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    d->mouseMoveEvent(event);
+}
+
+void QUInt128SpinBox::mousePressEvent(QMouseEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    d->mousePressEvent(event);
+}
+
+void QUInt128SpinBox::mouseReleaseEvent(QMouseEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    d->mouseReleaseEvent(event);
+}
+
+void QUInt128SpinBox::paintEvent(QPaintEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    if (!d->paintEvent(event)) {
+        QAbstractSpinBox::paintEvent(event);
+    }
+}
+
+void QUInt128SpinBox::resizeEvent(QResizeEvent *event)
+{
+    QWidget::resizeEvent(event);
+
+    Q_D(QUInt128SpinBox);
+    d->resizeEvent(event);
+}
+
+void QUInt128SpinBox::showEvent(QShowEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    d->showEvent(event);
+}
+
+void QUInt128SpinBox::timerEvent(QTimerEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    d->timerEvent(event);
+    QWidget::timerEvent(event);
+}
+
+#if QT_CONFIG(wheelevent)
+void QUInt128SpinBox::wheelEvent(QWheelEvent *event)
+{
+    Q_D(QUInt128SpinBox);
+    d->wheelEvent(event);
+}
+#endif // QT_CONFIG(wheelevent)
+} // namespace QtExtraSpinBoxes
+#endif // QT_SUPPORTS_INT128
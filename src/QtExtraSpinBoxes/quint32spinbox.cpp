@@ -57,8 +57,17 @@ protected:
     void emitSignalsImpl() override
     {
         Q_Q(QUInt32SpinBox);
-        Q_EMIT q->textChanged(q_edit()->displayText());
+        if (q->isSignalConnected(QMetaMethod::fromSignal(&QUInt32SpinBox::textChanged))) {
+            Q_EMIT q->textChanged(displayText());
+        }
         Q_EMIT q->valueChanged(value);
+        Q_EMIT q->valueChangedDetailed(lastEmittedValue, value, changeSource, interacting);
+    }
+
+    void emitFinishedImpl() override
+    {
+        Q_Q(QUInt32SpinBox);
+        Q_EMIT q->valueChangedDetailed(value, value, changeSource, false);
     }
 };
 
@@ -108,6 +117,18 @@ void QUInt32SpinBox::setRange(Type minimum, Type maximum)
     d->setRange(minimum, maximum);
 }
 
+QList<QUInt32SpinBox::Type> QUInt32SpinBox::allowedValues() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->allowedValues;
+}
+
+void QUInt32SpinBox::setAllowedValues(const QList<Type> &values)
+{
+    Q_D(QUInt32SpinBox);
+    d->setAllowedValues(values);
+}
+
 QUInt32SpinBox::Type QUInt32SpinBox::singleStep() const
 {
     Q_D(const QUInt32SpinBox);
@@ -168,6 +189,204 @@ void QUInt32SpinBox::setStepType(StepType stepType)
     d->stepType = stepType;
 }
 
+int QUInt32SpinBox::adaptiveSignificantDigits() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->adaptiveSignificantDigits;
+}
+
+void QUInt32SpinBox::setAdaptiveSignificantDigits(int digits)
+{
+    Q_D(QUInt32SpinBox);
+    d->setAdaptiveSignificantDigits(digits);
+}
+
+StepMode QUInt32SpinBox::stepMode() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->stepMode;
+}
+
+void QUInt32SpinBox::setStepMode(StepMode mode)
+{
+    Q_D(QUInt32SpinBox);
+    d->stepMode = mode;
+}
+
+QUInt32SpinBox::Type QUInt32SpinBox::stepFactor() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->stepFactor;
+}
+
+void QUInt32SpinBox::setStepFactor(Type factor)
+{
+    Q_D(QUInt32SpinBox);
+    d->setStepFactor(factor);
+}
+
+OverflowPolicy QUInt32SpinBox::overflowPolicy() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->overflowPolicy;
+}
+
+void QUInt32SpinBox::setOverflowPolicy(OverflowPolicy policy)
+{
+    Q_D(QUInt32SpinBox);
+    d->overflowPolicy = policy;
+}
+
+bool QUInt32SpinBox::isCursorDigitStepping() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->cursorDigitStepping;
+}
+
+void QUInt32SpinBox::setCursorDigitStepping(bool enable)
+{
+    Q_D(QUInt32SpinBox);
+    d->cursorDigitStepping = enable;
+}
+
+bool QUInt32SpinBox::isChromeCached() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->chromeCached;
+}
+
+void QUInt32SpinBox::setChromeCached(bool enable)
+{
+    Q_D(QUInt32SpinBox);
+    d->setChromeCached(enable);
+}
+
+bool QUInt32SpinBox::isGlyphCached() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->glyphCached;
+}
+
+void QUInt32SpinBox::setGlyphCached(bool enable)
+{
+    Q_D(QUInt32SpinBox);
+    d->setGlyphCached(enable);
+}
+
+bool QUInt32SpinBox::isFramePaced() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->framePaced;
+}
+
+void QUInt32SpinBox::setFramePaced(bool enable)
+{
+    Q_D(QUInt32SpinBox);
+    d->setFramePaced(enable);
+}
+
+AccelerationCurve QUInt32SpinBox::accelerationCurve() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->accelerationCurve;
+}
+
+void QUInt32SpinBox::setAccelerationCurve(AccelerationCurve curve)
+{
+    Q_D(QUInt32SpinBox);
+    d->accelerationCurve = curve;
+}
+
+void QUInt32SpinBox::setAccelerationFunction(const AccelerationFunction &function)
+{
+    Q_D(QUInt32SpinBox);
+    d->setAccelerationFunction(function);
+}
+
+WheelMode QUInt32SpinBox::wheelMode() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->wheelMode;
+}
+
+void QUInt32SpinBox::setWheelMode(WheelMode mode)
+{
+    Q_D(QUInt32SpinBox);
+    d->wheelMode = mode;
+}
+
+bool QUInt32SpinBox::isScrubEnabled() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->scrubEnabled;
+}
+
+void QUInt32SpinBox::setScrubEnabled(bool enable)
+{
+    Q_D(QUInt32SpinBox);
+    d->scrubEnabled = enable;
+}
+
+AccelerationCurve QUInt32SpinBox::scrubCurve() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->scrubCurve;
+}
+
+void QUInt32SpinBox::setScrubCurve(AccelerationCurve curve)
+{
+    Q_D(QUInt32SpinBox);
+    d->scrubCurve = curve;
+}
+
+void QUInt32SpinBox::setScrubFunction(const ScrubFunction &function)
+{
+    Q_D(QUInt32SpinBox);
+    d->setScrubFunction(function);
+}
+
+int QUInt32SpinBox::keyboardTrackingDelay() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->keyboardTrackingDelay;
+}
+
+void QUInt32SpinBox::setKeyboardTrackingDelay(int msec)
+{
+    Q_D(QUInt32SpinBox);
+    d->setKeyboardTrackingDelay(msec);
+}
+
+int QUInt32SpinBox::emissionInterval() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->emissionInterval;
+}
+
+void QUInt32SpinBox::setEmissionInterval(int msec)
+{
+    Q_D(QUInt32SpinBox);
+    d->setEmissionInterval(msec);
+}
+
+bool QUInt32SpinBox::isInteracting() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->interacting;
+}
+
+QUInt32SpinBox::Type QUInt32SpinBox::deadband() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->deadband;
+}
+
+void QUInt32SpinBox::setDeadband(Type delta)
+{
+    Q_D(QUInt32SpinBox);
+    d->setDeadband(delta);
+}
+
 void QUInt32SpinBox::fixup(QString &input) const
 {
     Q_D(const QUInt32SpinBox);
@@ -180,6 +399,24 @@ void QUInt32SpinBox::stepBy(int steps)
     d->stepBy(steps);
 }
 
+void QUInt32SpinBox::stepUpBy(Type count)
+{
+    Q_D(QUInt32SpinBox);
+    d->stepByWide(count, true);
+}
+
+void QUInt32SpinBox::stepDownBy(Type count)
+{
+    Q_D(QUInt32SpinBox);
+    d->stepByWide(count, false);
+}
+
+void QUInt32SpinBox::stepTo(Type target)
+{
+    Q_D(QUInt32SpinBox);
+    d->stepTo(target);
+}
+
 QValidator::State QUInt32SpinBox::validate(QString &input, int &pos) const
 {
     Q_D(const QUInt32SpinBox);
@@ -202,6 +439,12 @@ QUInt32SpinBox::Type QUInt32SpinBox::value() const
     return d->value;
 }
 
+QString QUInt32SpinBox::valueText() const
+{
+    Q_D(const QUInt32SpinBox);
+    return d->displayText();
+}
+
 QSize QUInt32SpinBox::minimumSizeHint() const
 {
     Q_D(const QUInt32SpinBox);
@@ -318,6 +561,14 @@ void QUInt32SpinBox::mouseReleaseEvent(QMouseEvent *event)
     d->mouseReleaseEvent(event);
 }
 
+void QUInt32SpinBox::paintEvent(QPaintEvent *event)
+{
+    Q_D(QUInt32SpinBox);
+    if (!d->paintEvent(event)) {
+        QAbstractSpinBox::paintEvent(event);
+    }
+}
+
 void QUInt32SpinBox::resizeEvent(QResizeEvent *event)
 {
     QWidget::resizeEvent(event);
@@ -336,7 +587,7 @@ void QUInt32SpinBox::timerEvent(QTimerEvent *event)
 {
     Q_D(QUInt32SpinBox);
     d->timerEvent(event);
-    QWidget::changeEvent(event);
+    QWidget::timerEvent(event);
 }
 
 #if QT_CONFIG(wheelevent)
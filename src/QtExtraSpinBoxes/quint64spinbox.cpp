@@ -57,8 +57,17 @@ protected:
     void emitSignalsImpl() override
     {
         Q_Q(QUInt64SpinBox);
-        Q_EMIT q->textChanged(q_edit()->displayText());
+        if (q->isSignalConnected(QMetaMethod::fromSignal(&QUInt64SpinBox::textChanged))) {
+            Q_EMIT q->textChanged(displayText());
+        }
         Q_EMIT q->valueChanged(value);
+        Q_EMIT q->valueChangedDetailed(lastEmittedValue, value, changeSource, interacting);
+    }
+
+    void emitFinishedImpl() override
+    {
+        Q_Q(QUInt64SpinBox);
+        Q_EMIT q->valueChangedDetailed(value, value, changeSource, false);
     }
 };
 
@@ -108,6 +117,18 @@ void QUInt64SpinBox::setRange(Type minimum, Type maximum)
     d->setRange(minimum, maximum);
 }
 
+QList<QUInt64SpinBox::Type> QUInt64SpinBox::allowedValues() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->allowedValues;
+}
+
+void QUInt64SpinBox::setAllowedValues(const QList<Type> &values)
+{
+    Q_D(QUInt64SpinBox);
+    d->setAllowedValues(values);
+}
+
 QUInt64SpinBox::Type QUInt64SpinBox::singleStep() const
 {
     Q_D(const QUInt64SpinBox);
@@ -168,6 +189,204 @@ void QUInt64SpinBox::setStepType(StepType stepType)
     d->stepType = stepType;
 }
 
+int QUInt64SpinBox::adaptiveSignificantDigits() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->adaptiveSignificantDigits;
+}
+
+void QUInt64SpinBox::setAdaptiveSignificantDigits(int digits)
+{
+    Q_D(QUInt64SpinBox);
+    d->setAdaptiveSignificantDigits(digits);
+}
+
+StepMode QUInt64SpinBox::stepMode() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->stepMode;
+}
+
+void QUInt64SpinBox::setStepMode(StepMode mode)
+{
+    Q_D(QUInt64SpinBox);
+    d->stepMode = mode;
+}
+
+QUInt64SpinBox::Type QUInt64SpinBox::stepFactor() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->stepFactor;
+}
+
+void QUInt64SpinBox::setStepFactor(Type factor)
+{
+    Q_D(QUInt64SpinBox);
+    d->setStepFactor(factor);
+}
+
+OverflowPolicy QUInt64SpinBox::overflowPolicy() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->overflowPolicy;
+}
+
+void QUInt64SpinBox::setOverflowPolicy(OverflowPolicy policy)
+{
+    Q_D(QUInt64SpinBox);
+    d->overflowPolicy = policy;
+}
+
+bool QUInt64SpinBox::isCursorDigitStepping() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->cursorDigitStepping;
+}
+
+void QUInt64SpinBox::setCursorDigitStepping(bool enable)
+{
+    Q_D(QUInt64SpinBox);
+    d->cursorDigitStepping = enable;
+}
+
+bool QUInt64SpinBox::isChromeCached() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->chromeCached;
+}
+
+void QUInt64SpinBox::setChromeCached(bool enable)
+{
+    Q_D(QUInt64SpinBox);
+    d->setChromeCached(enable);
+}
+
+bool QUInt64SpinBox::isGlyphCached() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->glyphCached;
+}
+
+void QUInt64SpinBox::setGlyphCached(bool enable)
+{
+    Q_D(QUInt64SpinBox);
+    d->setGlyphCached(enable);
+}
+
+bool QUInt64SpinBox::isFramePaced() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->framePaced;
+}
+
+void QUInt64SpinBox::setFramePaced(bool enable)
+{
+    Q_D(QUInt64SpinBox);
+    d->setFramePaced(enable);
+}
+
+AccelerationCurve QUInt64SpinBox::accelerationCurve() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->accelerationCurve;
+}
+
+void QUInt64SpinBox::setAccelerationCurve(AccelerationCurve curve)
+{
+    Q_D(QUInt64SpinBox);
+    d->accelerationCurve = curve;
+}
+
+void QUInt64SpinBox::setAccelerationFunction(const AccelerationFunction &function)
+{
+    Q_D(QUInt64SpinBox);
+    d->setAccelerationFunction(function);
+}
+
+WheelMode QUInt64SpinBox::wheelMode() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->wheelMode;
+}
+
+void QUInt64SpinBox::setWheelMode(WheelMode mode)
+{
+    Q_D(QUInt64SpinBox);
+    d->wheelMode = mode;
+}
+
+bool QUInt64SpinBox::isScrubEnabled() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->scrubEnabled;
+}
+
+void QUInt64SpinBox::setScrubEnabled(bool enable)
+{
+    Q_D(QUInt64SpinBox);
+    d->scrubEnabled = enable;
+}
+
+AccelerationCurve QUInt64SpinBox::scrubCurve() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->scrubCurve;
+}
+
+void QUInt64SpinBox::setScrubCurve(AccelerationCurve curve)
+{
+    Q_D(QUInt64SpinBox);
+    d->scrubCurve = curve;
+}
+
+void QUInt64SpinBox::setScrubFunction(const ScrubFunction &function)
+{
+    Q_D(QUInt64SpinBox);
+    d->setScrubFunction(function);
+}
+
+int QUInt64SpinBox::keyboardTrackingDelay() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->keyboardTrackingDelay;
+}
+
+void QUInt64SpinBox::setKeyboardTrackingDelay(int msec)
+{
+    Q_D(QUInt64SpinBox);
+    d->setKeyboardTrackingDelay(msec);
+}
+
+int QUInt64SpinBox::emissionInterval() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->emissionInterval;
+}
+
+void QUInt64SpinBox::setEmissionInterval(int msec)
+{
+    Q_D(QUInt64SpinBox);
+    d->setEmissionInterval(msec);
+}
+
+bool QUInt64SpinBox::isInteracting() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->interacting;
+}
+
+QUInt64SpinBox::Type QUInt64SpinBox::deadband() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->deadband;
+}
+
+void QUInt64SpinBox::setDeadband(Type delta)
+{
+    Q_D(QUInt64SpinBox);
+    d->setDeadband(delta);
+}
+
 void QUInt64SpinBox::fixup(QString &input) const
 {
     Q_D(const QUInt64SpinBox);
@@ -180,6 +399,24 @@ void QUInt64SpinBox::stepBy(int steps)
     d->stepBy(steps);
 }
 
+void QUInt64SpinBox::stepUpBy(Type count)
+{
+    Q_D(QUInt64SpinBox);
+    d->stepByWide(count, true);
+}
+
+void QUInt64SpinBox::stepDownBy(Type count)
+{
+    Q_D(QUInt64SpinBox);
+    d->stepByWide(count, false);
+}
+
+void QUInt64SpinBox::stepTo(Type target)
+{
+    Q_D(QUInt64SpinBox);
+    d->stepTo(target);
+}
+
 QValidator::State QUInt64SpinBox::validate(QString &input, int &pos) const
 {
     Q_D(const QUInt64SpinBox);
@@ -202,6 +439,12 @@ QUInt64SpinBox::Type QUInt64SpinBox::value() const
     return d->value;
 }
 
+QString QUInt64SpinBox::valueText() const
+{
+    Q_D(const QUInt64SpinBox);
+    return d->displayText();
+}
+
 QSize QUInt64SpinBox::minimumSizeHint() const
 {
     Q_D(const QUInt64SpinBox);
@@ -318,6 +561,14 @@ void QUInt64SpinBox::mouseReleaseEvent(QMouseEvent *event)
     d->mouseReleaseEvent(event);
 }
 
+void QUInt64SpinBox::paintEvent(QPaintEvent *event)
+{
+    Q_D(QUInt64SpinBox);
+    if (!d->paintEvent(event)) {
+        QAbstractSpinBox::paintEvent(event);
+    }
+}
+
 void QUInt64SpinBox::resizeEvent(QResizeEvent *event)
 {
     QWidget::resizeEvent(event);
@@ -336,7 +587,7 @@ void QUInt64SpinBox::timerEvent(QTimerEvent *event)
 {
     Q_D(QUInt64SpinBox);
     d->timerEvent(event);
-    QWidget::changeEvent(event);
+    QWidget::timerEvent(event);
 }
 
 #if QT_CONFIG(wheelevent)
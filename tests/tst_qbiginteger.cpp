@@ -0,0 +1,279 @@
+// SPDX-FileCopyrightText: 2025 Trần Nam Tuấn <tuantran1632001@gmail.com>
+// SPDX-License-Identifier: GPL-3.0-only
+
+#include <QtExtraSpinBoxes/qbiginteger.hpp>
+
+#include <QTest>
+
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace QtExtraSpinBoxes;
+
+namespace
+{
+// Little endian 32 bit limbs, worked on by plain quadratic algorithms that the
+// Karatsuba, Newton and divide and conquer paths of QBigInteger are checked against.
+using Limbs = std::vector<quint32>;
+
+// Sizes in limbs around the Karatsuba threshold of 32 limbs and the Newton
+// threshold of 64 limbs.
+const std::vector<int> boundarySizes = {1, 2, 3, 31, 32, 33, 63, 64, 65, 66, 127, 128, 129};
+
+enum Fill {
+    Random,
+    Ones, // every bit set, the most carries
+    Power, // a single bit at the top, the most borrows
+};
+
+void trim(Limbs &a)
+{
+    while (!a.empty() && a.back() == 0) {
+        a.pop_back();
+    }
+}
+
+Limbs operand(int size, Fill fill, quint32 seed)
+{
+    std::mt19937 random(seed);
+    Limbs limbs(size);
+    for (quint32 &limb : limbs) {
+        limb = fill == Ones ? 0xffffffffu : (fill == Power ? 0 : static_cast<quint32>(random()));
+    }
+    limbs.back() = fill == Power ? 1 : (limbs.back() | 1);
+    return limbs;
+}
+
+Limbs multiply(const Limbs &a, const Limbs &b)
+{
+    Limbs product(a.size() + b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        quint64 carry = 0;
+        for (size_t j = 0; j < b.size(); ++j) {
+            const quint64 t = quint64(a[i]) * b[j] + product[i + j] + carry;
+            product[i + j] = static_cast<quint32>(t);
+            carry = t >> 32;
+        }
+        product[i + b.size()] = static_cast<quint32>(carry);
+    }
+    trim(product);
+    return product;
+}
+
+// Digits by repeated division by the largest power of the base that fits a limb.
+QString toString(Limbs a, int base, bool negative = false)
+{
+    trim(a);
+    if (a.empty()) {
+        return QStringLiteral("0");
+    }
+    int chunkDigits = 1;
+    quint64 chunk = base;
+    while (chunk * base <= 0xffffffffu) {
+        chunk *= base;
+        ++chunkDigits;
+    }
+
+    std::string digits;
+    while (!a.empty()) {
+        quint64 remainder = 0;
+        for (size_t i = a.size(); i-- > 0;) {
+            const quint64 current = (remainder << 32) | a[i];
+            a[i] = static_cast<quint32>(current / chunk);
+            remainder = current % chunk;
+        }
+        trim(a);
+        for (int i = 0; i < chunkDigits && (remainder != 0 || !a.empty()); ++i) {
+            digits.push_back("0123456789abcdefghijklmnopqrstuvwxyz"[remainder % base]);
+            remainder /= base;
+        }
+    }
+    if (negative) {
+        digits.push_back('-');
+    }
+    return QString::fromStdString(std::string(digits.rbegin(), digits.rend()));
+}
+
+QBigInteger toBigInteger(const Limbs &a, bool negative = false)
+{
+    return QBigInteger::fromString(toString(a, 16, negative), 16);
+}
+
+QBigInteger magnitude(const QBigInteger &value)
+{
+    return value.isNegative() ? -value : value;
+}
+
+const char *fillName(Fill fill)
+{
+    return fill == Ones ? "ones" : (fill == Power ? "power" : "random");
+}
+} // namespace
+
+class TestQBigInteger : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void zero();
+    void conversion_data();
+    void conversion();
+    void multiplication_data();
+    void multiplication();
+    void division_data();
+    void division();
+};
+
+void TestQBigInteger::zero()
+{
+    const QBigInteger zero;
+    const QBigInteger value = toBigInteger(operand(65, Random, 1));
+
+    QCOMPARE(zero.toString(), QStringLiteral("0"));
+    QVERIFY(!(-zero).isNegative());
+    QVERIFY(QBigInteger::fromString(u"-0").isZero());
+    QVERIFY(!QBigInteger::fromString(u"-0").isNegative());
+    QVERIFY((zero * value).isZero());
+    QVERIFY((value * zero).isZero());
+    QVERIFY(!(-value * zero).isNegative());
+    QVERIFY((zero / value).isZero());
+    QVERIFY((zero % -value).isZero());
+    QVERIFY(!(zero / -value).isNegative());
+    QVERIFY((value - value).isZero());
+    QVERIFY(!(value - value).isNegative());
+}
+
+void TestQBigInteger::conversion_data()
+{
+    QTest::addColumn<int>("size");
+    QTest::addColumn<int>("fill");
+    QTest::addColumn<int>("base");
+
+    // Large enough values also divide by reciprocals of the powers of the base.
+    std::vector<int> sizes = boundarySizes;
+    sizes.insert(sizes.end(), {130, 131, 300, 1000});
+    for (const int size : sizes) {
+        for (const Fill fill : {Random, Ones, Power}) {
+            for (const int base : {10, 16, 7, 36}) {
+                if (size > 300 && base != 10 && base != 7) {
+                    continue;
+                }
+                QTest::addRow("%d %s base %d", size, fillName(fill), base) << size << int(fill) << base;
+            }
+        }
+    }
+}
+
+void TestQBigInteger::conversion()
+{
+    QFETCH(int, size);
+    QFETCH(int, fill);
+    QFETCH(int, base);
+
+    const Limbs limbs = operand(size, Fill(fill), size);
+    const QString expected = toString(limbs, base);
+    const QBigInteger value = toBigInteger(limbs);
+    QCOMPARE(value.toString(base), expected);
+    QCOMPARE((-value).toString(base), QStringLiteral("-") + expected);
+
+    bool ok = false;
+    QCOMPARE(QBigInteger::fromString(expected, base, &ok).toString(16), toString(limbs, 16));
+    QVERIFY(ok);
+    QCOMPARE(QBigInteger::fromString(QStringLiteral("-") + expected, base, &ok).toString(16), toString(limbs, 16, true));
+    QVERIFY(ok);
+}
+
+void TestQBigInteger::multiplication_data()
+{
+    QTest::addColumn<int>("leftSize");
+    QTest::addColumn<int>("rightSize");
+    QTest::addColumn<int>("leftFill");
+    QTest::addColumn<int>("rightFill");
+
+    std::vector<std::pair<int, int>> sizes;
+    for (const int size : boundarySizes) {
+        sizes.emplace_back(size, size);
+        sizes.emplace_back(size, size + 1);
+    }
+    // Unbalanced products are sliced into pieces of the shorter operand.
+    sizes.insert(sizes.end(), {{33, 1}, {64, 31}, {64, 32}, {65, 32}, {100, 32}, {200, 33}, {129, 64}, {500, 64}, {1000, 65}});
+    for (const auto &[left, right] : sizes) {
+        for (const auto &[leftFill, rightFill] : {std::pair(Random, Random), std::pair(Ones, Ones), std::pair(Ones, Random), std::pair(Power, Ones)}) {
+            QTest::addRow("%dx%d %s %s", left, right, fillName(leftFill), fillName(rightFill)) << left << right << int(leftFill) << int(rightFill);
+            if (left != right || leftFill != rightFill) {
+                QTest::addRow("%dx%d %s %s", right, left, fillName(rightFill), fillName(leftFill)) << right << left << int(rightFill) << int(leftFill);
+            }
+        }
+    }
+}
+
+void TestQBigInteger::multiplication()
+{
+    QFETCH(int, leftSize);
+    QFETCH(int, rightSize);
+    QFETCH(int, leftFill);
+    QFETCH(int, rightFill);
+
+    const Limbs left = operand(leftSize, Fill(leftFill), leftSize * 7919);
+    const Limbs right = operand(rightSize, Fill(rightFill), rightSize * 104729 + 1);
+    const Limbs product = multiply(left, right);
+    for (const bool leftNegative : {false, true}) {
+        for (const bool rightNegative : {false, true}) {
+            const QBigInteger result = toBigInteger(left, leftNegative) * toBigInteger(right, rightNegative);
+            QCOMPARE(result.toString(16), toString(product, 16, leftNegative != rightNegative));
+        }
+    }
+}
+
+void TestQBigInteger::division_data()
+{
+    QTest::addColumn<int>("dividendSize");
+    QTest::addColumn<int>("divisorSize");
+    QTest::addColumn<int>("dividendFill");
+    QTest::addColumn<int>("divisorFill");
+
+    for (const int divisor : boundarySizes) {
+        for (const int dividend : std::set<int>{divisor, divisor + 1, 2 * divisor, 2 * divisor + 1, 3 * divisor + 5}) {
+            for (const auto &[dividendFill, divisorFill] : {std::pair(Random, Random), std::pair(Ones, Ones), std::pair(Ones, Power), std::pair(Power, Ones)}) {
+                QTest::addRow("%d/%d %s %s", dividend, divisor, fillName(dividendFill), fillName(divisorFill))
+                    << dividend << divisor << int(dividendFill) << int(divisorFill);
+            }
+        }
+    }
+}
+
+void TestQBigInteger::division()
+{
+    QFETCH(int, dividendSize);
+    QFETCH(int, divisorSize);
+    QFETCH(int, dividendFill);
+    QFETCH(int, divisorFill);
+
+    const Limbs dividendLimbs = operand(dividendSize, Fill(dividendFill), dividendSize * 31 + 3);
+    const Limbs divisorLimbs = operand(divisorSize, Fill(divisorFill), divisorSize * 37 + 5);
+    for (const bool dividendNegative : {false, true}) {
+        for (const bool divisorNegative : {false, true}) {
+            const QBigInteger a = toBigInteger(dividendLimbs, dividendNegative);
+            const QBigInteger b = toBigInteger(divisorLimbs, divisorNegative);
+            const QBigInteger q = a / b;
+            const QBigInteger r = a % b;
+
+            // Truncating division: a = q b + r with |r| < |b| and r taking the sign of a.
+            QCOMPARE((q * b + r).toString(16), a.toString(16));
+            QVERIFY(magnitude(r) < magnitude(b));
+            QVERIFY(r.isZero() || r.isNegative() == dividendNegative);
+            QVERIFY(q.isZero() || q.isNegative() == (dividendNegative != divisorNegative));
+
+            // An exact quotient, against the reference product.
+            const QBigInteger product = toBigInteger(multiply(dividendLimbs, divisorLimbs), dividendNegative != divisorNegative);
+            QCOMPARE((product / b).toString(16), a.toString(16));
+            QVERIFY((product % b).isZero());
+        }
+    }
+}
+
+QTEST_GUILESS_MAIN(TestQBigInteger)
+
+#include "tst_qbiginteger.moc"